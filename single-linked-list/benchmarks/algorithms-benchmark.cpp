@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+SingleLinkedList<int64_t> MakeRandomList(size_t size) {
+    mt19937_64 random(size);
+    uniform_int_distribution<int64_t> distribution(0, static_cast<int64_t>(size));
+    SingleLinkedList<int64_t> list;
+    for (size_t i = 0; i < size; ++i) {
+        list.PushBack(distribution(random));
+    }
+    return list;
+}
+
+// Копирует список в вектор, обрабатывает вектор и собирает новый
+// список — так список обрабатывался до появления методов,
+// перецепляющих узлы
+template <typename Process>
+void VectorRoundTrip(SingleLinkedList<int64_t>& list, Process process) {
+    vector<int64_t> values(list.begin(), list.end());
+    process(values);
+    SingleLinkedList<int64_t> rebuilt;
+    for (const int64_t value : values) {
+        rebuilt.PushBack(value);
+    }
+    list = std::move(rebuilt);
+}
+
+template <typename Run>
+void Measure(BenchmarkReport& report, const string& name,
+             const string& method, size_t size, Run run) {
+    SingleLinkedList<int64_t> list = MakeRandomList(size);
+    BenchmarkResult result;
+    result.name = name;
+    result.labels = {{"method", method}};
+    result.size = size;
+    result.operations = size;
+    result.total_ns = MeasureNs([&] {
+        run(list);
+    });
+    DoNotOptimize(*list.begin());
+    report.Add(std::move(result));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("algorithms", ParseBenchmarkOptions(argc, argv));
+    const vector<size_t> sizes =
+        report.GetOptions().quick ? vector<size_t>{100'000}
+                                  : vector<size_t>{1'000'000, 4'000'000};
+    for (const size_t size : sizes) {
+        Measure(report, "Sort", "relink", size, [](auto& list) {
+            list.Sort();
+        });
+        Measure(report, "Sort", "vector", size, [](auto& list) {
+            VectorRoundTrip(list, [](auto& values) {
+                stable_sort(values.begin(), values.end());
+            });
+        });
+        Measure(report, "Reverse", "relink", size, [](auto& list) {
+            list.Reverse();
+        });
+        Measure(report, "Reverse", "vector", size, [](auto& list) {
+            VectorRoundTrip(list, [](auto& values) {
+                reverse(values.begin(), values.end());
+            });
+        });
+        Measure(report, "SortUnique", "relink", size, [](auto& list) {
+            list.Sort();
+            list.Unique();
+        });
+        Measure(report, "SortUnique", "vector", size, [](auto& list) {
+            VectorRoundTrip(list, [](auto& values) {
+                stable_sort(values.begin(), values.end());
+                values.erase(unique(values.begin(), values.end()),
+                             values.end());
+            });
+        });
+        Measure(report, "RemoveIf", "relink", size, [](auto& list) {
+            list.RemoveIf([](int64_t value) {
+                return value % 2 == 0;
+            });
+        });
+        Measure(report, "RemoveIf", "vector", size, [](auto& list) {
+            VectorRoundTrip(list, [](auto& values) {
+                values.erase(remove_if(values.begin(), values.end(),
+                                       [](int64_t value) {
+                                           return value % 2 == 0;
+                                       }),
+                             values.end());
+            });
+        });
+    }
+    return report.Finish();
+}
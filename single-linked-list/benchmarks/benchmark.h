@@ -0,0 +1,171 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*
+ * Общая часть бенчмарков: замер времени, сбор результатов и их
+ * вывод в человекочитаемом виде и в JSON.
+ * Каждый исполняемый файл бенчмарка принимает ключи
+ *   --json=<путь>  записать результаты в файл в формате JSON
+ *   --quick        уменьшить размеры и число повторов
+ */
+
+// Не даёт компилятору выбросить вычисление value как неиспользуемое
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// Параметры запуска бенчмарка
+struct BenchmarkOptions {
+    std::string json_path;
+    bool quick = false;
+};
+
+inline BenchmarkOptions ParseBenchmarkOptions(int argc, char** argv) {
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--quick") {
+            options.quick = true;
+        } else if (arg.substr(0, 7) == "--json=") {
+            options.json_path = std::string(arg.substr(7));
+        } else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+        }
+    }
+    return options;
+}
+
+// Результат одного замера
+struct BenchmarkResult {
+    // Название операции, например "PushBack"
+    std::string name;
+    // Дополнительные параметры замера: тип элемента, аллокатор и т.п.
+    std::vector<std::pair<std::string, std::string>> labels;
+    // Размер списка, на котором выполнялся замер
+    size_t size = 0;
+    // Количество измеренных операций
+    size_t operations = 0;
+    // Суммарное время в наносекундах
+    double total_ns = 0;
+
+    [[nodiscard]] double NsPerOp() const noexcept {
+        return operations == 0 ? 0 : total_ns / static_cast<double>(operations);
+    }
+};
+
+// Выполняет func и возвращает затраченное время в наносекундах
+template <typename Func>
+double MeasureNs(Func&& func) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(finish - start).count();
+}
+
+// Собирает результаты набора бенчмарков
+class BenchmarkReport {
+public:
+    BenchmarkReport(std::string suite, BenchmarkOptions options)
+        : suite_(std::move(suite))
+        , options_(std::move(options)) {
+    }
+
+    [[nodiscard]] const BenchmarkOptions& GetOptions() const noexcept {
+        return options_;
+    }
+
+    // Добавляет результат и печатает его в стандартный вывод
+    void Add(BenchmarkResult result) {
+        std::cout << suite_ << '/' << result.name;
+        for (const auto& [key, value] : result.labels) {
+            std::cout << ' ' << key << '=' << value;
+        }
+        std::cout << " size=" << result.size << ": " << std::fixed
+                  << std::setprecision(2) << result.NsPerOp() << " ns/op"
+                  << std::defaultfloat << std::endl;
+        results_.push_back(std::move(result));
+    }
+
+    // Записывает результаты в формате JSON
+    void WriteJson(std::ostream& out) const {
+        out << "{\n  \"suite\": " << Quote(suite_)
+            << ",\n  \"results\": [";
+        for (size_t i = 0; i < results_.size(); ++i) {
+            const BenchmarkResult& result = results_[i];
+            out << (i == 0 ? "\n" : ",\n") << "    {\"name\": "
+                << Quote(result.name);
+            for (const auto& [key, value] : result.labels) {
+                out << ", " << Quote(key) << ": " << Quote(value);
+            }
+            out << ", \"size\": " << result.size
+                << ", \"operations\": " << result.operations
+                << ", \"total_ns\": " << result.total_ns
+                << ", \"ns_per_op\": " << result.NsPerOp() << '}';
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    // Записывает JSON в файл из параметров запуска, если он задан
+    // Возвращает код завершения для main
+    int Finish() const {
+        if (options_.json_path.empty()) {
+            return 0;
+        }
+        std::ofstream out(options_.json_path);
+        if (!out) {
+            std::cerr << "cannot open " << options_.json_path << std::endl;
+            return 1;
+        }
+        WriteJson(out);
+        return out ? 0 : 1;
+    }
+
+private:
+    static std::string Quote(std::string_view text) {
+        std::string result = "\"";
+        for (const char c : text) {
+            switch (c) {
+                case '"':
+                    result += "\\\"";
+                    break;
+                case '\\':
+                    result += "\\\\";
+                    break;
+                case '\n':
+                    result += "\\n";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                        result += escaped;
+                    } else {
+                        result += c;
+                    }
+            }
+        }
+        result += '"';
+        return result;
+    }
+
+    std::string suite_;
+    BenchmarkOptions options_;
+    std::vector<BenchmarkResult> results_;
+};
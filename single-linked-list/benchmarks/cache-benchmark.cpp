@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <list>
+#include <new>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../list-cache.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Объём памяти, занятой в куче в данный момент. Размер блока
+// хранится перед ним, чтобы учитывать и освобождения
+atomic<size_t> g_live_bytes{0};
+constexpr size_t kHeaderSize = alignof(max_align_t);
+
+}  // namespace
+
+void* operator new(size_t size) {
+    if (void* block = malloc(size + kHeaderSize)) {
+        *static_cast<size_t*>(block) = size;
+        g_live_bytes.fetch_add(size, memory_order_relaxed);
+        return static_cast<char*>(block) + kHeaderSize;
+    }
+    throw bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+    void* block = static_cast<char*>(ptr) - kHeaderSize;
+    g_live_bytes.fetch_sub(*static_cast<size_t*>(block),
+                           memory_order_relaxed);
+    free(block);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+namespace {
+
+// Последовательность ключей 0..universe-1 с распределением Ципфа:
+// ключ k встречается с частотой, пропорциональной 1 / (k + 1)^s
+vector<uint32_t> MakeZipfTrace(size_t universe, double s, size_t length) {
+    vector<double> cdf(universe);
+    double sum = 0;
+    for (size_t k = 0; k < universe; ++k) {
+        sum += 1.0 / pow(static_cast<double>(k + 1), s);
+        cdf[k] = sum;
+    }
+    mt19937_64 generator(42);
+    uniform_real_distribution<double> distribution(0, sum);
+    vector<uint32_t> trace(length);
+    for (uint32_t& key : trace) {
+        key = static_cast<uint32_t>(
+            lower_bound(cdf.begin(), cdf.end(), distribution(generator)) -
+            cdf.begin());
+    }
+    return trace;
+}
+
+// Привычный LRU-кэш из std::list и std::unordered_map итераторов —
+// вариант, с которым сравниваются кэши на односвязном списке
+class StdListLruCache {
+public:
+    explicit StdListLruCache(size_t capacity)
+        : capacity_(capacity) {
+    }
+
+    const uint64_t* Get(uint32_t key) {
+        const auto it = index_.find(key);
+        if (it == index_.end()) {
+            return nullptr;
+        }
+        entries_.splice(entries_.end(), entries_, it->second);
+        return &it->second->second;
+    }
+
+    void Put(uint32_t key, uint64_t value) {
+        entries_.emplace_back(key, value);
+        index_.emplace(key, prev(entries_.end()));
+        if (entries_.size() > capacity_) {
+            index_.erase(entries_.front().first);
+            entries_.pop_front();
+        }
+    }
+
+private:
+    size_t capacity_;
+    list<pair<uint32_t, uint64_t>> entries_;
+    unordered_map<uint32_t, list<pair<uint32_t, uint64_t>>::iterator>
+        index_;
+};
+
+// Проигрывает trace: при промахе значение записывается в кэш.
+// Операция — одно обращение. Метки hit_rate и bytes_per_entry
+// показывают долю попаданий и память кучи на одну запись кэша
+template <typename Cache>
+void RunTrace(BenchmarkReport& report, const string& cache_name,
+              const vector<uint32_t>& trace, size_t capacity) {
+    const size_t bytes_before = g_live_bytes.load();
+    size_t hits = 0;
+    double total_ns = 0;
+    size_t bytes_per_entry = 0;
+    {
+        Cache cache(capacity);
+        total_ns = MeasureNs([&] {
+            for (const uint32_t key : trace) {
+                if (cache.Get(key) != nullptr) {
+                    ++hits;
+                } else {
+                    cache.Put(key, key);
+                }
+            }
+        });
+        bytes_per_entry = (g_live_bytes.load() - bytes_before) / capacity;
+    }
+
+    BenchmarkResult result;
+    result.name = "ZipfTrace";
+    result.labels = {
+        {"cache", cache_name},
+        {"capacity", to_string(capacity)},
+        {"hit_rate", to_string(static_cast<double>(hits) /
+                               static_cast<double>(trace.size()))},
+        {"bytes_per_entry", to_string(bytes_per_entry)}};
+    result.size = capacity;
+    result.operations = trace.size();
+    result.total_ns = total_ns;
+    report.Add(std::move(result));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("cache", ParseBenchmarkOptions(argc, argv));
+    const bool quick = report.GetOptions().quick;
+    const size_t universe = quick ? 100'000 : 1'000'000;
+    const vector<uint32_t> trace =
+        MakeZipfTrace(universe, 0.99, quick ? 200'000 : 5'000'000);
+    for (const size_t capacity : {universe / 100, universe / 10}) {
+        RunTrace<LruCache<uint32_t, uint64_t>>(report, "lru", trace,
+                                               capacity);
+        RunTrace<FifoCache<uint32_t, uint64_t>>(report, "fifo", trace,
+                                                capacity);
+        RunTrace<StdListLruCache>(report, "std_list_lru", trace, capacity);
+    }
+    return report.Finish();
+}
@@ -0,0 +1,284 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../channel-list.h"
+#include "../single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Размер пачки, которую потребитель забирает за одно пробуждение
+constexpr size_t kBatchSize = 256;
+
+// Очередь на основе SingleLinkedList под мьютексом, которую
+// потребители опрашивают в цикле, — вариант, с которым сравнивается
+// ChannelList
+class PollingQueue {
+public:
+    explicit PollingQueue(size_t) {
+    }
+
+    void PushBack(int64_t value) {
+        lock_guard guard(mutex_);
+        list_.PushBack(value);
+    }
+
+    template <typename Consume>
+    void ConsumeAll(Consume consume) {
+        while (const optional<int64_t> value = PopFront()) {
+            consume(*value);
+        }
+    }
+
+    void Close() {
+        lock_guard guard(mutex_);
+        closed_ = true;
+    }
+
+private:
+    optional<int64_t> PopFront() {
+        while (true) {
+            {
+                lock_guard guard(mutex_);
+                if (!list_.IsEmpty()) {
+                    optional<int64_t> result(*list_.begin());
+                    list_.PopFront();
+                    return result;
+                }
+                if (closed_) {
+                    return nullopt;
+                }
+            }
+            this_thread::yield();
+        }
+    }
+
+    mutex mutex_;
+    SingleLinkedList<int64_t> list_;
+    bool closed_ = false;
+};
+
+// Потребитель ChannelList, извлекающий по одному элементу
+class ChannelPop {
+public:
+    explicit ChannelPop(size_t capacity)
+        : channel_(capacity) {
+    }
+
+    void PushBack(int64_t value) {
+        channel_.PushBack(value);
+    }
+
+    template <typename Consume>
+    void ConsumeAll(Consume consume) {
+        while (const optional<int64_t> value = channel_.PopFront()) {
+            consume(*value);
+        }
+    }
+
+    void Close() {
+        channel_.Close();
+    }
+
+protected:
+    ChannelList<int64_t> channel_;
+};
+
+// Потребитель ChannelList, забирающий пачки через PopFrontN
+class ChannelBatch : public ChannelPop {
+public:
+    using ChannelPop::ChannelPop;
+
+    template <typename Consume>
+    void ConsumeAll(Consume consume) {
+        while (true) {
+            const SingleLinkedList<int64_t> batch =
+                channel_.PopFrontN(kBatchSize);
+            if (batch.IsEmpty()) {
+                break;
+            }
+            for (const int64_t value : batch) {
+                consume(value);
+            }
+        }
+    }
+};
+
+int64_t NowNs() {
+    return chrono::duration_cast<chrono::nanoseconds>(
+               chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// Запускает producers производителей и consumers потребителей.
+// Операция — передача одного элемента от производителя потребителю
+template <typename Queue>
+void RunThroughput(BenchmarkReport& report, const string& mode,
+                   size_t capacity, size_t producers, size_t consumers,
+                   size_t items_per_producer) {
+    Queue queue(capacity);
+    atomic<int64_t> checksum = 0;
+
+    BenchmarkResult result;
+    result.name = "Throughput";
+    result.labels = {
+        {"mode", mode},
+        {"capacity", capacity == ChannelList<int64_t>::kUnbounded
+                         ? string("unbounded")
+                         : to_string(capacity)},
+        {"producers", to_string(producers)},
+        {"consumers", to_string(consumers)}};
+    result.size = producers * items_per_producer;
+    result.operations = result.size;
+    result.total_ns = MeasureNs([&] {
+        vector<thread> consumer_threads;
+        for (size_t c = 0; c < consumers; ++c) {
+            consumer_threads.emplace_back([&queue, &checksum] {
+                int64_t sum = 0;
+                queue.ConsumeAll([&sum](int64_t value) {
+                    sum += value;
+                });
+                checksum += sum;
+            });
+        }
+        vector<thread> producer_threads;
+        for (size_t p = 0; p < producers; ++p) {
+            producer_threads.emplace_back([&queue, items_per_producer] {
+                for (size_t i = 0; i < items_per_producer; ++i) {
+                    queue.PushBack(static_cast<int64_t>(i));
+                }
+            });
+        }
+        for (thread& producer : producer_threads) {
+            producer.join();
+        }
+        queue.Close();
+        for (thread& consumer : consumer_threads) {
+            consumer.join();
+        }
+    });
+    DoNotOptimize(checksum.load());
+    report.Add(std::move(result));
+}
+
+// Сопрограмма-потребитель для замера задержки: её возобновляет
+// поток производителя
+struct DetachedCoroutine {
+    struct promise_type {
+        DetachedCoroutine get_return_object() noexcept {
+            return {};
+        }
+        suspend_never initial_suspend() noexcept {
+            return {};
+        }
+        suspend_never final_suspend() noexcept {
+            return {};
+        }
+        void return_void() noexcept {
+        }
+        void unhandled_exception() noexcept {
+            terminate();
+        }
+    };
+};
+
+DetachedCoroutine ConsumeLatencies(ChannelList<int64_t>& channel,
+                                   vector<int64_t>& latencies,
+                                   atomic<size_t>& received) {
+    while (const optional<int64_t> sent = co_await channel.PopFrontAsync()) {
+        latencies.push_back(NowNs() - *sent);
+        received.store(received.load() + 1, memory_order_release);
+    }
+}
+
+// Производитель отправляет время отправки и ждёт, пока потребитель
+// его получит, поэтому каждый элемент застаёт потребителя спящим.
+// Операция — один элемент, время — средняя задержка от PushBack до
+// получения, метки p50_ns и p99_ns — её перцентили
+template <typename StartConsumer>
+void RunLatency(BenchmarkReport& report, const string& mode, size_t items,
+                StartConsumer start_consumer) {
+    ChannelList<int64_t> channel;
+    vector<int64_t> latencies;
+    latencies.reserve(items);
+    atomic<size_t> received = 0;
+    thread consumer = start_consumer(channel, latencies, received);
+    for (size_t i = 0; i < items; ++i) {
+        channel.PushBack(NowNs());
+        while (received.load(memory_order_acquire) <= i) {
+            this_thread::yield();
+        }
+    }
+    channel.Close();
+    if (consumer.joinable()) {
+        consumer.join();
+    }
+
+    sort(latencies.begin(), latencies.end());
+    BenchmarkResult result;
+    result.name = "Latency";
+    result.labels = {
+        {"mode", mode},
+        {"p50_ns", to_string(latencies[latencies.size() / 2])},
+        {"p99_ns", to_string(latencies[latencies.size() * 99 / 100])}};
+    result.size = items;
+    result.operations = items;
+    for (const int64_t latency : latencies) {
+        result.total_ns += static_cast<double>(latency);
+    }
+    report.Add(std::move(result));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("channel", ParseBenchmarkOptions(argc, argv));
+    const bool quick = report.GetOptions().quick;
+    const size_t items = quick ? 20'000 : 500'000;
+    const size_t unbounded = ChannelList<int64_t>::kUnbounded;
+    const vector<pair<size_t, size_t>> topologies = {
+        {1, 1}, {1, 4}, {4, 1}, {4, 4}};
+    for (const auto& [producers, consumers] : topologies) {
+        const size_t per_producer = items / producers;
+        RunThroughput<PollingQueue>(report, "poll", unbounded, producers,
+                                       consumers, per_producer);
+        for (const size_t capacity : {unbounded, size_t{1024}}) {
+            RunThroughput<ChannelPop>(report, "pop", capacity, producers,
+                                      consumers, per_producer);
+            RunThroughput<ChannelBatch>(report, "batch", capacity, producers,
+                                        consumers, per_producer);
+        }
+    }
+
+    const size_t latency_items = quick ? 2'000 : 50'000;
+    RunLatency(report, "thread", latency_items,
+               [](ChannelList<int64_t>& channel, vector<int64_t>& latencies,
+                  atomic<size_t>& received) {
+                   return thread([&channel, &latencies, &received] {
+                       while (const optional<int64_t> sent =
+                                  channel.PopFront()) {
+                           latencies.push_back(NowNs() - *sent);
+                           received.store(received.load() + 1,
+                                          memory_order_release);
+                       }
+                   });
+               });
+    RunLatency(report, "coroutine", latency_items,
+               [](ChannelList<int64_t>& channel, vector<int64_t>& latencies,
+                  atomic<size_t>& received) {
+                   ConsumeLatencies(channel, latencies, received);
+                   return thread();
+               });
+    return report.Finish();
+}
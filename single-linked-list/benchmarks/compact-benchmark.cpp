@@ -0,0 +1,100 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "../compact-single-linked-list.h"
+#include "../single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Счётчики выделений памяти всей программы: по ним видно, сколько
+// памяти в куче занимают узлы списка
+atomic<size_t> g_allocations{0};
+atomic<size_t> g_allocated_bytes{0};
+
+}  // namespace
+
+void* operator new(size_t size) {
+    g_allocations.fetch_add(1, memory_order_relaxed);
+    g_allocated_bytes.fetch_add(size, memory_order_relaxed);
+    if (void* ptr = malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+namespace {
+
+// Заполняет список size элементами int32_t и обходит его.
+// Операция — один элемент. Метки bytes_per_element и
+// allocs_per_element показывают, сколько памяти запрошено из кучи на
+// элемент и сколько раз: к каждому выделению malloc добавляет ещё
+// свой заголовок
+template <typename List>
+void Run(BenchmarkReport& report, const string& container, size_t size) {
+    const size_t allocations_before = g_allocations.load();
+    const size_t bytes_before = g_allocated_bytes.load();
+    List list;
+
+    BenchmarkResult build;
+    build.name = "Build";
+    build.total_ns = MeasureNs([&] {
+        for (size_t i = 0; i < size; ++i) {
+            list.PushBack(static_cast<int32_t>(i));
+        }
+    });
+    const double elements = static_cast<double>(size);
+    const double allocations =
+        static_cast<double>(g_allocations.load() - allocations_before);
+    const double bytes =
+        static_cast<double>(g_allocated_bytes.load() - bytes_before);
+
+    BenchmarkResult iterate;
+    iterate.name = "Iterate";
+    iterate.total_ns = MeasureNs([&] {
+        int64_t sum = 0;
+        for (const int32_t value : list) {
+            sum += value;
+        }
+        DoNotOptimize(sum);
+    });
+
+    for (BenchmarkResult* result : {&build, &iterate}) {
+        result->labels = {
+            {"container", container},
+            {"bytes_per_element", to_string(bytes / elements)},
+            {"allocs_per_element", to_string(allocations / elements)}};
+        result->size = size;
+        result->operations = size;
+        report.Add(std::move(*result));
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("compact", ParseBenchmarkOptions(argc, argv));
+    const vector<size_t> sizes = report.GetOptions().quick
+        ? vector<size_t>{1'000, 100'000}
+        : vector<size_t>{1'000, 1'000'000, 10'000'000};
+    for (const size_t size : sizes) {
+        Run<SingleLinkedList<int32_t>>(report, "pointer_nodes", size);
+        Run<CompactSingleLinkedList<int32_t>>(report, "compact", size);
+    }
+    return report.Finish();
+}
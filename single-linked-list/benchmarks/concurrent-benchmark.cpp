@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../concurrent-single-linked-list.h"
+#include "../single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Очередь на основе SingleLinkedList под общим мьютексом —
+// вариант, с которым сравнивается lock-free список
+template <typename Type>
+class MutexQueue {
+public:
+    void PushBack(const Type& value) {
+        lock_guard guard(mutex_);
+        list_.PushBack(value);
+    }
+
+    optional<Type> TryPopFront() {
+        lock_guard guard(mutex_);
+        if (list_.IsEmpty()) {
+            return nullopt;
+        }
+        optional<Type> result(std::move(*list_.begin()));
+        list_.PopFront();
+        return result;
+    }
+
+private:
+    mutex mutex_;
+    SingleLinkedList<Type> list_;
+};
+
+// Запускает threads потоков: половина добавляет элементы, половина
+// извлекает. Операция — добавление либо извлечение одного элемента
+template <typename Queue>
+void RunProducersConsumers(BenchmarkReport& report, const string& queue_name,
+                           size_t threads, size_t items_per_producer) {
+    Queue queue;
+    const size_t producers = max<size_t>(1, threads / 2);
+    const size_t consumers = max<size_t>(1, threads - producers);
+    const size_t total = producers * items_per_producer;
+    atomic<size_t> popped = 0;
+
+    BenchmarkResult result;
+    result.name = "ProducerConsumer";
+    result.labels = {{"queue", queue_name},
+                     {"threads", to_string(producers + consumers)}};
+    result.size = total;
+    result.operations = 2 * total;
+    result.total_ns = MeasureNs([&] {
+        vector<thread> workers;
+        for (size_t p = 0; p < producers; ++p) {
+            workers.emplace_back([&queue, items_per_producer] {
+                for (size_t i = 0; i < items_per_producer; ++i) {
+                    queue.PushBack(static_cast<int64_t>(i));
+                }
+            });
+        }
+        for (size_t c = 0; c < consumers; ++c) {
+            workers.emplace_back([&queue, &popped, total] {
+                while (popped.load(memory_order_relaxed) < total) {
+                    if (queue.TryPopFront()) {
+                        popped.fetch_add(1, memory_order_relaxed);
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    });
+    report.Add(std::move(result));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("concurrent", ParseBenchmarkOptions(argc, argv));
+    const size_t items_per_producer =
+        report.GetOptions().quick ? 20'000 : 500'000;
+    const size_t max_threads =
+        max<size_t>(2, thread::hardware_concurrency());
+    for (size_t threads = 2; threads <= max_threads; threads *= 2) {
+        RunProducersConsumers<MutexQueue<int64_t>>(report, "mutex", threads,
+                                                   items_per_producer);
+        RunProducersConsumers<ConcurrentSingleLinkedList<int64_t>>(
+            report, "lock_free", threads, items_per_producer);
+    }
+    return report.Finish();
+}
@@ -0,0 +1,124 @@
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../indexed-single-linked-list.h"
+#include "../single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Упорядоченное по вставке множество на SingleLinkedList с
+// линейным поиском — вариант, с которым сравнивается индекс
+class LinearScanSet {
+public:
+    void PushBack(int key, int value) {
+        list_.PushBack({key, value});
+    }
+
+    const int* Find(int key) const {
+        for (const auto& [k, value] : list_) {
+            if (k == key) {
+                return &value;
+            }
+        }
+        return nullptr;
+    }
+
+    // Второй проход не нужен: предыдущий узел запоминается по пути
+    bool EraseKey(int key) {
+        auto prev = list_.before_begin();
+        for (auto it = list_.begin(); it != list_.end(); ++it, ++prev) {
+            if (it->first == key) {
+                list_.EraseAfter(prev);
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    SingleLinkedList<pair<int, int>> list_;
+};
+
+class IndexedSet {
+public:
+    void PushBack(int key, int value) {
+        list_.PushBack(key, value);
+    }
+
+    const int* Find(int key) const {
+        const auto it = list_.Find(key);
+        return it != list_.end() ? &it->second : nullptr;
+    }
+
+    bool EraseKey(int key) {
+        return list_.EraseKey(key);
+    }
+
+private:
+    IndexedSingleLinkedList<int, int> list_;
+};
+
+// Find — поиск случайного ключа, Erase — удаление случайного ключа
+// и его повторная вставка в конец. Операция — один ключ
+template <typename Set>
+void RunSet(BenchmarkReport& report, const string& container, size_t size,
+            size_t operations) {
+    Set set;
+    for (size_t i = 0; i < size; ++i) {
+        set.PushBack(static_cast<int>(i), static_cast<int>(i));
+    }
+    mt19937 generator(42);
+    uniform_int_distribution<int> distribution(0, static_cast<int>(size) - 1);
+    vector<int> keys(operations);
+    for (int& key : keys) {
+        key = distribution(generator);
+    }
+
+    BenchmarkResult find;
+    find.name = "Find";
+    find.total_ns = MeasureNs([&] {
+        int64_t sum = 0;
+        for (const int key : keys) {
+            if (const int* value = set.Find(key)) {
+                sum += *value;
+            }
+        }
+        DoNotOptimize(sum);
+    });
+
+    BenchmarkResult erase;
+    erase.name = "Erase";
+    erase.total_ns = MeasureNs([&] {
+        for (const int key : keys) {
+            if (set.EraseKey(key)) {
+                set.PushBack(key, key);
+            }
+        }
+    });
+
+    for (BenchmarkResult* result : {&find, &erase}) {
+        result->labels = {{"container", container}};
+        result->size = size;
+        result->operations = operations;
+        report.Add(std::move(*result));
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("indexed", ParseBenchmarkOptions(argc, argv));
+    const size_t operations = report.GetOptions().quick ? 1'000 : 20'000;
+    for (const size_t size : {16, 256, 4'096, 65'536}) {
+        RunSet<LinearScanSet>(report, "linear_scan", size, operations);
+        RunSet<IndexedSet>(report, "indexed", size, operations);
+    }
+    return report.Finish();
+}
@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../intrusive-single-linked-list.h"
+#include "../single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Объект размером Size байт, живущий в арене пользователя
+template <size_t Size>
+struct Object {
+    IntrusiveListHook hook;
+    int64_t key = 0;
+    char payload[Size - sizeof(IntrusiveListHook) - sizeof(int64_t)] = {};
+};
+
+static_assert(sizeof(Object<64>) == 64);
+static_assert(sizeof(Object<1024>) == 1024);
+
+// Сравнивает интрузивный список объектов арены с владеющим списком
+// их копий. Операция — обработка одного объекта
+template <size_t Size>
+class IntrusiveBenchmarks {
+public:
+    using Item = Object<Size>;
+    using Intrusive = IntrusiveSingleLinkedList<Item, &Item::hook>;
+    using Owning = SingleLinkedList<Item>;
+
+    IntrusiveBenchmarks(BenchmarkReport& report, size_t size,
+                        size_t repeats)
+        : report_(report)
+        , size_(size)
+        , repeats_(repeats)
+        , arena_(size) {
+        for (size_t i = 0; i < size_; ++i) {
+            arena_[i].key = static_cast<int64_t>(i);
+        }
+    }
+
+    void RunAll() {
+        Run("Build", "intrusive", [this] {
+            Intrusive list;
+            return MeasureNs([&] {
+                for (Item& item : arena_) {
+                    list.PushBack(item);
+                }
+            });
+        });
+        Run("Build", "owning", [this] {
+            Owning list;
+            return MeasureNs([&] {
+                for (const Item& item : arena_) {
+                    list.PushBack(item);
+                }
+            });
+        });
+        Run("Iterate", "intrusive", [this] {
+            Intrusive list;
+            for (Item& item : arena_) {
+                list.PushBack(item);
+            }
+            return MeasureNs([&] {
+                DoNotOptimize(Checksum(list));
+            });
+        });
+        Run("Iterate", "owning", [this] {
+            Owning list(arena_.begin(), arena_.end());
+            return MeasureNs([&] {
+                DoNotOptimize(Checksum(list));
+            });
+        });
+        Run("PopFront", "intrusive", [this] {
+            Intrusive list;
+            for (Item& item : arena_) {
+                list.PushBack(item);
+            }
+            return MeasureNs([&] {
+                while (!list.IsEmpty()) {
+                    list.PopFront();
+                }
+            });
+        });
+        Run("PopFront", "owning", [this] {
+            Owning list(arena_.begin(), arena_.end());
+            return MeasureNs([&] {
+                while (!list.IsEmpty()) {
+                    list.PopFront();
+                }
+            });
+        });
+    }
+
+private:
+    template <typename List>
+    static int64_t Checksum(const List& list) {
+        int64_t sum = 0;
+        for (const Item& item : list) {
+            sum += item.key;
+        }
+        return sum;
+    }
+
+    template <typename Measure>
+    void Run(const string& name, const string& mode, Measure measure) {
+        BenchmarkResult result;
+        result.name = name;
+        result.labels = {{"mode", mode},
+                         {"object_size", to_string(Size)}};
+        result.size = size_;
+        for (size_t r = 0; r < repeats_; ++r) {
+            result.total_ns += measure();
+            result.operations += size_;
+        }
+        report_.Add(std::move(result));
+    }
+
+    BenchmarkReport& report_;
+    size_t size_;
+    size_t repeats_;
+    vector<Item> arena_;
+};
+
+template <size_t Size>
+void RunForSize(BenchmarkReport& report, const vector<size_t>& sizes,
+                size_t target_elements) {
+    for (const size_t size : sizes) {
+        const size_t repeats = max<size_t>(1, target_elements / size);
+        IntrusiveBenchmarks<Size>(report, size, repeats).RunAll();
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("intrusive", ParseBenchmarkOptions(argc, argv));
+    const bool quick = report.GetOptions().quick;
+    const vector<size_t> sizes = quick ? vector<size_t>{1'000}
+                                       : vector<size_t>{1'000, 100'000};
+    const size_t target_elements = quick ? 10'000 : 1'000'000;
+    RunForSize<64>(report, sizes, target_elements);
+    RunForSize<1024>(report, sizes, target_elements);
+    return report.Finish();
+}
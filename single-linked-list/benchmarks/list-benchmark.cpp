@@ -0,0 +1,269 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Элемент размером 256 байт без нетривиальных операций
+struct Pod256 {
+    array<char, 256> bytes;
+
+    bool operator==(const Pod256& rhs) const noexcept {
+        return bytes == rhs.bytes;
+    }
+    bool operator!=(const Pod256& rhs) const noexcept {
+        return bytes != rhs.bytes;
+    }
+    bool operator<(const Pod256& rhs) const noexcept {
+        return bytes < rhs.bytes;
+    }
+};
+
+template <typename Type>
+Type MakeValue(size_t i);
+
+template <>
+int MakeValue<int>(size_t i) {
+    return static_cast<int>(i);
+}
+
+template <>
+string MakeValue<string>(size_t i) {
+    // Строка длиннее буфера малых строк, чтобы учитывалось выделение
+    // памяти под символы
+    return "benchmark-value-" + to_string(i) + "-payload";
+}
+
+template <>
+Pod256 MakeValue<Pod256>(size_t i) {
+    Pod256 value{};
+    value.bytes.fill(static_cast<char>(i));
+    return value;
+}
+
+// Вклад элемента в контрольную сумму обхода
+size_t Touch(int value) {
+    return static_cast<size_t>(value);
+}
+
+size_t Touch(const string& value) {
+    return value.size();
+}
+
+size_t Touch(const Pod256& value) {
+    return static_cast<size_t>(value.bytes[0]);
+}
+
+// StatsPolicy позволяет сравнить список без статистики со списком,
+// считающим операции через CountingListStats
+template <typename Type, typename StatsPolicy = NoListStats>
+class ListBenchmarks {
+public:
+    using List = SingleLinkedList<Type, allocator<Type>, StatsPolicy>;
+
+    ListBenchmarks(BenchmarkReport& report, string type_name, size_t size,
+                   size_t repeats)
+        : report_(report)
+        , type_name_(std::move(type_name))
+        , size_(size)
+        , repeats_(repeats) {
+        values_.reserve(size_);
+        for (size_t i = 0; i < size_; ++i) {
+            values_.push_back(MakeValue<Type>(i));
+        }
+    }
+
+    void RunAll() {
+        Run("PushFront", [this] {
+            List list;
+            return MeasureNs([&] {
+                for (const Type& value : values_) {
+                    list.PushFront(value);
+                }
+            });
+        });
+        Run("PushBack", [this] {
+            List list;
+            return MeasureNs([&] {
+                for (const Type& value : values_) {
+                    list.PushBack(value);
+                }
+            });
+        });
+        Run("RangeConstruct", [this] {
+            return MeasureNs([&] {
+                List list(values_.begin(), values_.end());
+                DoNotOptimize(list);
+            });
+        });
+        Run("Assign", [this] {
+            List list;
+            return MeasureNs([&] {
+                list.Assign(values_.begin(), values_.end());
+            });
+        });
+        Run("InsertAfterRange", [this] {
+            List list{values_.front()};
+            return MeasureNs([&] {
+                list.InsertAfter(list.cbegin(), values_.begin(),
+                                 values_.end());
+            });
+        });
+        Run("InsertAfter", [this] {
+            List list{values_.front()};
+            return MeasureNs([&] {
+                for (const Type& value : values_) {
+                    list.InsertAfter(list.cbegin(), value);
+                }
+            });
+        });
+        Run("EraseAfter", [this] {
+            List list = MakeList();
+            list.PushFront(values_.front());
+            return MeasureNs([&] {
+                for (size_t i = 0; i < size_; ++i) {
+                    list.EraseAfter(list.cbegin());
+                }
+            });
+        });
+        Run("PopFront", [this] {
+            List list = MakeList();
+            return MeasureNs([&] {
+                for (size_t i = 0; i < size_; ++i) {
+                    list.PopFront();
+                }
+            });
+        });
+        Run("Clear", [this] {
+            List list = MakeList();
+            return MeasureNs([&] {
+                list.Clear();
+            });
+        });
+        Run("ClearRefill", [this] {
+            List list = MakeList();
+            return MeasureNs([&] {
+                list.Clear();
+                for (const Type& value : values_) {
+                    list.PushBack(value);
+                }
+            });
+        });
+        Run("ClearKeepCapacityRefill", [this] {
+            List list = MakeList();
+            return MeasureNs([&] {
+                list.Clear(kKeepCapacity);
+                for (const Type& value : values_) {
+                    list.PushBack(value);
+                }
+            });
+        });
+        Run("CopyConstruct", [this] {
+            const List source = MakeList();
+            return MeasureNs([&] {
+                List copy(source);
+                DoNotOptimize(copy);
+            });
+        });
+        Run("CopyAssign", [this] {
+            const List source = MakeList();
+            List target = MakeList();
+            return MeasureNs([&] {
+                target = source;
+                DoNotOptimize(target);
+            });
+        });
+        Run("Equal", [this] {
+            const List lhs = MakeList();
+            const List rhs = MakeList();
+            return MeasureNs([&] {
+                DoNotOptimize(lhs == rhs);
+            });
+        });
+        Run("Less", [this] {
+            const List lhs = MakeList();
+            const List rhs = MakeList();
+            return MeasureNs([&] {
+                DoNotOptimize(lhs < rhs);
+            });
+        });
+        Run("Iterate", [this] {
+            const List list = MakeList();
+            return MeasureNs([&] {
+                size_t checksum = 0;
+                for (const Type& value : list) {
+                    checksum += Touch(value);
+                }
+                DoNotOptimize(checksum);
+            });
+        });
+    }
+
+private:
+    List MakeList() const {
+        List list;
+        for (const Type& value : values_) {
+            list.PushBack(value);
+        }
+        return list;
+    }
+
+    // Повторяет замер repeats_ раз. Каждый замер обрабатывает size_
+    // элементов, подготовка данных вне MeasureNs не учитывается
+    template <typename Measure>
+    void Run(const string& name, Measure measure) {
+        BenchmarkResult result;
+        result.name = name;
+        result.labels = {{"type", type_name_},
+                         {"stats", StatsPolicy::kEnabled ? "counting"
+                                                         : "off"}};
+        result.size = size_;
+        for (size_t r = 0; r < repeats_; ++r) {
+            result.total_ns += measure();
+            result.operations += size_;
+        }
+        report_.Add(std::move(result));
+    }
+
+    BenchmarkReport& report_;
+    string type_name_;
+    size_t size_;
+    size_t repeats_;
+    vector<Type> values_;
+};
+
+template <typename Type, typename StatsPolicy = NoListStats>
+void RunForType(BenchmarkReport& report, const string& type_name,
+                const vector<size_t>& sizes, size_t target_elements) {
+    for (const size_t size : sizes) {
+        const size_t repeats = max<size_t>(1, target_elements / size);
+        ListBenchmarks<Type, StatsPolicy>(report, type_name, size, repeats)
+            .RunAll();
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("list", ParseBenchmarkOptions(argc, argv));
+    const bool quick = report.GetOptions().quick;
+    const vector<size_t> sizes = quick ? vector<size_t>{16, 1'000}
+                                       : vector<size_t>{16, 1'000, 100'000};
+    const size_t target_elements = quick ? 10'000 : 1'000'000;
+
+    RunForType<int>(report, "int", sizes, target_elements);
+    RunForType<string>(report, "string", sizes, target_elements);
+    RunForType<Pod256>(report, "pod256", sizes, target_elements);
+    // Цена включённой статистики на самом лёгком типе элементов
+    RunForType<int, CountingListStats>(report, "int", sizes,
+                                       target_elements);
+    return report.Finish();
+}
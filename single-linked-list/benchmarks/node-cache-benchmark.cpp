@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Сравнивает очередь в установившемся режиме с кэшем узлов и без
+// него: в очереди из length элементов чередуются PushBack и
+// PopFront. Каждая операция замеряется отдельно, поэтому ns/op
+// включает стоимость чтения часов. Метки p50_ns и p99_ns —
+// перцентили времени одной операции
+class NodeCacheBenchmarks {
+public:
+    NodeCacheBenchmarks(BenchmarkReport& report, size_t operations)
+        : report_(report)
+        , operations_(operations) {
+    }
+
+    void Run(size_t length, size_t cache_size) {
+        SingleLinkedList<int64_t> queue;
+        queue.SetNodeCacheSize(cache_size);
+        for (size_t i = 0; i < length; ++i) {
+            queue.PushBack(static_cast<int64_t>(i));
+        }
+        // Прогрев: кэш заполняется удалёнными узлами
+        for (size_t i = 0; i < cache_size; ++i) {
+            queue.PushBack(static_cast<int64_t>(i));
+            queue.PopFront();
+        }
+
+        vector<int64_t> push_ns(operations_);
+        vector<int64_t> pop_ns(operations_);
+        for (size_t i = 0; i < operations_; ++i) {
+            push_ns[i] = TimeNs([&] {
+                queue.PushBack(static_cast<int64_t>(i));
+            });
+            pop_ns[i] = TimeNs([&] {
+                queue.PopFront();
+            });
+        }
+        DoNotOptimize(queue.GetSize());
+
+        const string cache = cache_size == 0 ? "off" : to_string(cache_size);
+        Add("PushBack", length, cache, push_ns);
+        Add("PopFront", length, cache, pop_ns);
+    }
+
+private:
+    template <typename Func>
+    static int64_t TimeNs(Func func) {
+        const auto start = chrono::steady_clock::now();
+        func();
+        const auto finish = chrono::steady_clock::now();
+        return chrono::duration_cast<chrono::nanoseconds>(finish - start)
+            .count();
+    }
+
+    void Add(const string& name, size_t length, const string& cache,
+             vector<int64_t>& samples) {
+        BenchmarkResult result;
+        result.name = name;
+        for (const int64_t sample : samples) {
+            result.total_ns += static_cast<double>(sample);
+        }
+        sort(samples.begin(), samples.end());
+        result.labels = {
+            {"cache", cache},
+            {"p50_ns", to_string(samples[samples.size() / 2])},
+            {"p99_ns", to_string(samples[samples.size() * 99 / 100])}};
+        result.size = length;
+        result.operations = samples.size();
+        report_.Add(std::move(result));
+    }
+
+    BenchmarkReport& report_;
+    size_t operations_;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("node-cache", ParseBenchmarkOptions(argc, argv));
+    const size_t operations = report.GetOptions().quick ? 100'000 : 5'000'000;
+    NodeCacheBenchmarks benchmarks(report, operations);
+    for (const size_t length : {16, 4'096}) {
+        for (const size_t cache_size : {0, 16}) {
+            benchmarks.Run(length, cache_size);
+        }
+    }
+    return report.Finish();
+}
@@ -0,0 +1,58 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../node-pool.h"
+#include "../single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Имитирует очередь с интенсивной сменой элементов: список
+// держится около размера queue_size, на каждой итерации один
+// элемент добавляется в конец и один удаляется из начала
+template <typename List>
+void RunChurn(BenchmarkReport& report, const string& allocator,
+              size_t queue_size, size_t iterations) {
+    List list;
+    BenchmarkResult result;
+    result.name = "Churn";
+    result.labels = {{"allocator", allocator}};
+    result.size = queue_size;
+    result.operations = iterations;
+    result.total_ns = MeasureNs([&] {
+        for (size_t i = 0; i < queue_size; ++i) {
+            list.PushBack(static_cast<int64_t>(i));
+        }
+        int64_t checksum = 0;
+        for (size_t i = 0; i < iterations; ++i) {
+            checksum += *list.begin();
+            list.PopFront();
+            list.PushBack(static_cast<int64_t>(i));
+            if (i % 64 == 0) {
+                list.PushFront(checksum);
+                list.EraseAfter(list.cbefore_begin());
+            }
+        }
+        list.Clear();
+        DoNotOptimize(checksum);
+    });
+    report.Add(std::move(result));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("node_pool", ParseBenchmarkOptions(argc, argv));
+    const size_t iterations =
+        report.GetOptions().quick ? 100'000 : 10'000'000;
+    for (size_t queue_size : {16u, 1024u, 65536u}) {
+        RunChurn<SingleLinkedList<int64_t>>(report, "new_delete", queue_size,
+                                            iterations);
+        RunChurn<SingleLinkedList<int64_t, PoolAllocator<int64_t>>>(
+            report, "node_pool", queue_size, iterations);
+    }
+    return report.Finish();
+}
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../parallel-list-algorithms.h"
+#include "../single-linked-list.h"
+#include "../work-stealing-pool.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+using List = SingleLinkedList<int64_t>;
+
+// Замеряет масштабирование параллельных обходов по числу потоков.
+// Потоков может быть больше, чем ядер: тогда прирост ограничен
+// числом ядер, указанным в метке hardware_threads.
+// Операция — обработка одного элемента
+class ParallelBenchmarks {
+public:
+    ParallelBenchmarks(BenchmarkReport& report, size_t size, size_t repeats)
+        : report_(report)
+        , size_(size)
+        , repeats_(repeats) {
+        for (size_t i = 0; i < size_; ++i) {
+            list_.PushBack(static_cast<int64_t>(i % 1000));
+        }
+    }
+
+    void RunSerial() {
+        Run("ForEach", "serial", [this] {
+            for (int64_t& value : list_) {
+                ++value;
+            }
+        });
+        Run("Reduce", "serial", [this] {
+            DoNotOptimize(std::accumulate(list_.begin(), list_.end(),
+                                          int64_t{0}));
+        });
+        Run("Count", "serial", [this] {
+            DoNotOptimize(std::count_if(list_.begin(), list_.end(),
+                                        [](int64_t v) { return v % 3 == 0; }));
+        });
+        Run("BuildChunkIndex", "serial", [this] {
+            DoNotOptimize(
+                list_.BuildChunkIndex(kDefaultParallelChunkSize).GetChunkCount());
+        });
+    }
+
+    void RunParallel(size_t thread_count) {
+        WorkStealingPool pool(thread_count);
+        const auto index = list_.BuildChunkIndex(kDefaultParallelChunkSize);
+        const string threads = to_string(thread_count);
+        Run("ForEach", threads, [&] {
+            ParallelForEach(list_, index, [](int64_t& value) { ++value; }, pool);
+        });
+        Run("Reduce", threads, [&] {
+            DoNotOptimize(
+                ParallelReduce(list_, index, int64_t{0}, std::plus<>{}, pool));
+        });
+        Run("Count", threads, [&] {
+            DoNotOptimize(ParallelCount(
+                list_, index, [](int64_t v) { return v % 3 == 0; }, pool));
+        });
+    }
+
+private:
+    template <typename Measure>
+    void Run(const string& name, const string& threads, Measure measure) {
+        BenchmarkResult result;
+        result.name = name;
+        result.labels = {{"threads", threads},
+                         {"hardware_threads",
+                          to_string(WorkStealingPool::DefaultThreadCount())},
+                         {"chunk_size", to_string(kDefaultParallelChunkSize)}};
+        result.size = size_;
+        result.total_ns = MeasureNs([&] {
+            for (size_t r = 0; r < repeats_; ++r) {
+                measure();
+            }
+        });
+        result.operations = size_ * repeats_;
+        report_.Add(std::move(result));
+    }
+
+    BenchmarkReport& report_;
+    size_t size_;
+    size_t repeats_;
+    List list_;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("parallel", ParseBenchmarkOptions(argc, argv));
+    const bool quick = report.GetOptions().quick;
+    const size_t size = quick ? 200'000 : 10'000'000;
+    const size_t repeats = quick ? 2 : 5;
+    ParallelBenchmarks benchmarks(report, size, repeats);
+    benchmarks.RunSerial();
+    for (const size_t thread_count : {1, 2, 4, 8, 16, 32}) {
+        benchmarks.RunParallel(thread_count);
+    }
+    return report.Finish();
+}
@@ -0,0 +1,150 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "../persistent-single-linked-list.h"
+#include "../single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Счётчики выделений памяти всей программы: по ним видно, сколько
+// памяти занимает история версий списка
+atomic<size_t> g_allocations{0};
+atomic<size_t> g_allocated_bytes{0};
+
+}  // namespace
+
+void* operator new(size_t size) {
+    g_allocations.fetch_add(1, memory_order_relaxed);
+    g_allocated_bytes.fetch_add(size, memory_order_relaxed);
+    if (void* ptr = malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+namespace {
+
+void AddFront(SingleLinkedList<int>& list, int value) {
+    list.PushFront(value);
+}
+
+void AddFront(PersistentSingleLinkedList<int>& list, int value) {
+    list = list.PushFront(value);
+}
+
+// Снимок SingleLinkedList — полная копия, затем в текущую версию
+// добавляется элемент
+SingleLinkedList<int> NextVersion(vector<SingleLinkedList<int>>& history,
+                                  SingleLinkedList<int> current, int value) {
+    history.push_back(current);
+    AddFront(current, value);
+    return current;
+}
+
+// Снимок PersistentSingleLinkedList разделяет узлы с текущей версией
+PersistentSingleLinkedList<int> NextVersion(
+    vector<PersistentSingleLinkedList<int>>& history,
+    const PersistentSingleLinkedList<int>& current, int value) {
+    history.push_back(current);
+    return current.PushFront(value);
+}
+
+// Строит историю из count версий списка длины length: каждая версия
+// сохраняется снимком, после чего в начало добавляется элемент.
+// Операция Snapshot — один снимок с добавлением, Traverse — обход
+// одного снимка. Метки allocs_per_snapshot и bytes_per_snapshot
+// показывают память, которую занимает один снимок истории
+template <typename List>
+class PersistentBenchmarks {
+public:
+    PersistentBenchmarks(BenchmarkReport& report, string container,
+                         size_t count)
+        : report_(report)
+        , container_(std::move(container))
+        , count_(count) {
+    }
+
+    void Run(size_t length) {
+        List current;
+        for (size_t i = 0; i < length; ++i) {
+            AddFront(current, static_cast<int>(i));
+        }
+        vector<List> history;
+        history.reserve(count_);
+        const size_t allocations_before = g_allocations.load();
+        const size_t bytes_before = g_allocated_bytes.load();
+
+        BenchmarkResult snapshot;
+        snapshot.name = "Snapshot";
+        snapshot.total_ns = MeasureNs([&] {
+            for (size_t i = 0; i < count_; ++i) {
+                current = NextVersion(history, std::move(current),
+                                      static_cast<int>(i));
+            }
+        });
+        const size_t allocations = g_allocations.load() - allocations_before;
+        const size_t heap_bytes = g_allocated_bytes.load() - bytes_before;
+
+        BenchmarkResult traverse;
+        traverse.name = "Traverse";
+        traverse.total_ns = MeasureNs([&] {
+            int64_t sum = 0;
+            for (const List& version : history) {
+                for (const int value : version) {
+                    sum += value;
+                }
+            }
+            DoNotOptimize(sum);
+        });
+
+        const double per_snapshot = static_cast<double>(count_);
+        for (BenchmarkResult* result : {&snapshot, &traverse}) {
+            result->labels = {
+                {"container", container_},
+                {"length", to_string(length)},
+                {"allocs_per_snapshot",
+                 to_string(static_cast<double>(allocations) / per_snapshot)},
+                {"bytes_per_snapshot",
+                 to_string(sizeof(List) +
+                           static_cast<double>(heap_bytes) / per_snapshot)}};
+            result->size = length;
+            result->operations = count_;
+            report_.Add(std::move(*result));
+        }
+    }
+
+private:
+    BenchmarkReport& report_;
+    string container_;
+    size_t count_;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("persistent", ParseBenchmarkOptions(argc, argv));
+    const size_t count = report.GetOptions().quick ? 100 : 1'000;
+    for (const size_t length : {16, 1'024, 65'536}) {
+        PersistentBenchmarks<SingleLinkedList<int>>(report, "copy", count)
+            .Run(length);
+        PersistentBenchmarks<PersistentSingleLinkedList<int>>(
+            report, "persistent", count)
+            .Run(length);
+    }
+    return report.Finish();
+}
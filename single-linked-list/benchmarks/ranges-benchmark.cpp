@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "../list-ranges.h"
+#include "../single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+using List = SingleLinkedList<int64_t>;
+
+bool IsEven(int64_t value) {
+    return value % 2 == 0;
+}
+
+int64_t Square(int64_t value) {
+    return value * value;
+}
+
+// Сравнивает цепочку filter/transform/take, которая на каждом шаге
+// собирает новый список вызовами PushBack, с ленивой цепочкой
+// std::views, завершённой To<SingleLinkedList> или сразу свёрнутой.
+// Операция — один элемент исходного списка
+class RangesBenchmarks {
+public:
+    RangesBenchmarks(BenchmarkReport& report, size_t size, size_t repeats)
+        : report_(report)
+        , size_(size)
+        , repeats_(repeats)
+        , take_(size / 4) {
+        for (size_t i = 0; i < size_; ++i) {
+            source_.PushBack(static_cast<int64_t>(i));
+        }
+    }
+
+    void RunAll() {
+        Run("materialise", [this] {
+            List filtered;
+            for (const int64_t value : source_) {
+                if (IsEven(value)) {
+                    filtered.PushBack(value);
+                }
+            }
+            List transformed;
+            for (const int64_t value : filtered) {
+                transformed.PushBack(Square(value));
+            }
+            List taken;
+            for (auto it = transformed.begin();
+                 it != transformed.end() && taken.GetSize() < take_; ++it) {
+                taken.PushBack(*it);
+            }
+            return Checksum(taken);
+        });
+        Run("lazy_to_list", [this] {
+            const List taken = source_
+                               | views::filter(IsEven)
+                               | views::transform(Square)
+                               | views::take(take_)
+                               | To<SingleLinkedList>();
+            return Checksum(taken);
+        });
+        Run("lazy_consume", [this] {
+            return Checksum(source_
+                            | views::filter(IsEven)
+                            | views::transform(Square)
+                            | views::take(take_));
+        });
+    }
+
+private:
+    template <typename Range>
+    static int64_t Checksum(Range&& range) {
+        int64_t sum = 0;
+        for (const int64_t value : range) {
+            sum += value;
+        }
+        return sum;
+    }
+
+    template <typename Measure>
+    void Run(const string& mode, Measure measure) {
+        BenchmarkResult result;
+        result.name = "FilterTransformTake";
+        result.labels = {{"mode", mode}};
+        result.size = size_;
+        result.total_ns = MeasureNs([&] {
+            for (size_t r = 0; r < repeats_; ++r) {
+                DoNotOptimize(measure());
+            }
+        });
+        result.operations = size_ * repeats_;
+        report_.Add(std::move(result));
+    }
+
+    BenchmarkReport& report_;
+    size_t size_;
+    size_t repeats_;
+    size_t take_;
+    List source_;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("ranges", ParseBenchmarkOptions(argc, argv));
+    const bool quick = report.GetOptions().quick;
+    const vector<size_t> sizes = quick ? vector<size_t>{1'000}
+                                       : vector<size_t>{1'000, 1'000'000};
+    const size_t target_elements = quick ? 1'000'000 : 20'000'000;
+    for (const size_t size : sizes) {
+        const size_t repeats = max<size_t>(1, target_elements / size);
+        RangesBenchmarks(report, size, repeats).RunAll();
+    }
+    return report.Finish();
+}
@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../simd-kernels.h"
+#include "../single-linked-list.h"
+#include "../unrolled-single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+string LevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::kScalar:
+            return "scalar";
+        case SimdLevel::kVector128:
+            return "vector128";
+        case SimdLevel::kAvx2:
+            return "avx2";
+    }
+    return "unknown";
+}
+
+// Сравнивает обобщённые алгоритмы поверх итераторов с методами
+// Find/Count/Sum/MinMax и operator== контейнера.
+// Искомое значение отсутствует, поэтому Find просматривает все
+// элементы. Операция — просмотр одного элемента
+template <typename Type, typename Container>
+class SearchBenchmarks {
+public:
+    SearchBenchmarks(BenchmarkReport& report, string container,
+                     string type_name, size_t size, size_t repeats)
+        : report_(report)
+        , container_name_(std::move(container))
+        , type_name_(std::move(type_name))
+        , size_(size)
+        , repeats_(repeats) {
+        for (size_t i = 0; i < size_; ++i) {
+            const Type value = static_cast<Type>(i % 1000);
+            list_.PushBack(value);
+            copy_.PushBack(value);
+        }
+    }
+
+    void RunAll() {
+        const Type missing = static_cast<Type>(-1);
+        Run("Find", "iterator", [&] {
+            return static_cast<size_t>(
+                std::find(list_.begin(), list_.end(), missing) ==
+                list_.end());
+        });
+        Run("Find", "member", [&] {
+            return static_cast<size_t>(list_.Find(missing) == list_.end());
+        });
+        Run("Count", "iterator", [&] {
+            return static_cast<size_t>(
+                std::count(list_.begin(), list_.end(), Type(7)));
+        });
+        Run("Count", "member", [&] {
+            return list_.Count(Type(7));
+        });
+        Run("Sum", "iterator", [&] {
+            return static_cast<size_t>(
+                std::accumulate(list_.begin(), list_.end(), Type()));
+        });
+        Run("Sum", "member", [&] {
+            return static_cast<size_t>(list_.Sum());
+        });
+        Run("MinMax", "iterator", [&] {
+            const auto [min, max] =
+                std::minmax_element(list_.begin(), list_.end());
+            return static_cast<size_t>(*max - *min);
+        });
+        Run("MinMax", "member", [&] {
+            const auto [min, max] = list_.MinMax();
+            return static_cast<size_t>(max - min);
+        });
+        Run("Equal", "iterator", [&] {
+            return static_cast<size_t>(std::equal(
+                list_.begin(), list_.end(), copy_.begin(), copy_.end()));
+        });
+        Run("Equal", "member", [&] {
+            return static_cast<size_t>(list_ == copy_);
+        });
+    }
+
+private:
+    template <typename Measure>
+    void Run(const string& name, const string& method, Measure measure) {
+        BenchmarkResult result;
+        result.name = name;
+        result.labels = {{"container", container_name_},
+                         {"type", type_name_},
+                         {"method", method},
+                         {"simd", LevelName(SimdKernels::GetLevel())}};
+        result.size = size_;
+        result.total_ns = MeasureNs([&] {
+            for (size_t r = 0; r < repeats_; ++r) {
+                DoNotOptimize(measure());
+            }
+        });
+        result.operations = size_ * repeats_;
+        report_.Add(std::move(result));
+    }
+
+    BenchmarkReport& report_;
+    string container_name_;
+    string type_name_;
+    size_t size_;
+    size_t repeats_;
+    Container list_;
+    Container copy_;
+};
+
+template <typename Type>
+void RunForType(BenchmarkReport& report, const string& type_name,
+                const vector<size_t>& sizes, size_t target_elements) {
+    for (const size_t size : sizes) {
+        const size_t repeats = max<size_t>(1, target_elements / size);
+        SearchBenchmarks<Type, SingleLinkedList<Type>>(
+            report, "list", type_name, size, repeats)
+            .RunAll();
+        SearchBenchmarks<Type, UnrolledSingleLinkedList<Type, 64>>(
+            report, "unrolled", type_name, size, repeats)
+            .RunAll();
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("search", ParseBenchmarkOptions(argc, argv));
+    const bool quick = report.GetOptions().quick;
+    const vector<size_t> sizes = quick ? vector<size_t>{1'000}
+                                       : vector<size_t>{1'000, 1'000'000};
+    const size_t target_elements = quick ? 1'000'000 : 20'000'000;
+    RunForType<int32_t>(report, "int32", sizes, target_elements);
+    RunForType<float>(report, "float", sizes, target_elements);
+    return report.Finish();
+}
@@ -0,0 +1,120 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../mapped-single-linked-list.h"
+#include "../single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+struct Record {
+    int64_t id;
+    double weight;
+};
+
+// Загружает снимок и читает все элементы: текстовым разбором с
+// PushBack, через Deserialize либо отображением файла в память.
+// Операция — загрузка одного элемента
+class SerializationBenchmarks {
+public:
+    SerializationBenchmarks(BenchmarkReport& report, size_t size)
+        : report_(report)
+        , size_(size)
+        , directory_(filesystem::temp_directory_path())
+        , text_path_(directory_ / "single-linked-list-benchmark.txt")
+        , binary_path_(directory_ / "single-linked-list-benchmark.bin") {
+        SingleLinkedList<Record> list;
+        ofstream text(text_path_);
+        for (size_t i = 0; i < size_; ++i) {
+            const Record record{static_cast<int64_t>(i), i * 0.5};
+            list.PushBack(record);
+            text << record.id << ' ' << record.weight << '\n';
+        }
+        ofstream binary(binary_path_, ios::binary);
+        list.Serialize(binary);
+    }
+
+    SerializationBenchmarks(const SerializationBenchmarks&) = delete;
+    SerializationBenchmarks& operator=(const SerializationBenchmarks&) =
+        delete;
+
+    ~SerializationBenchmarks() {
+        filesystem::remove(text_path_);
+        filesystem::remove(binary_path_);
+    }
+
+    void RunAll() {
+        Run("Load", "text-parse", [this] {
+            ifstream in(text_path_);
+            SingleLinkedList<Record> list;
+            Record record;
+            while (in >> record.id >> record.weight) {
+                list.PushBack(record);
+            }
+            return Checksum(list);
+        });
+        Run("Load", "deserialize", [this] {
+            ifstream in(binary_path_, ios::binary);
+            const auto list = SingleLinkedList<Record>::Deserialize(in);
+            return Checksum(list);
+        });
+        Run("Load", "mmap", [this] {
+            const MappedSingleLinkedList<Record> list(binary_path_.string());
+            return Checksum(list);
+        });
+        // Холодный старт: открытие без обращения к элементам
+        Run("Open", "mmap", [this] {
+            const MappedSingleLinkedList<Record> list(binary_path_.string());
+            return static_cast<int64_t>(list.GetSize());
+        });
+    }
+
+private:
+    template <typename List>
+    static int64_t Checksum(const List& list) {
+        int64_t sum = 0;
+        for (auto it = list.cbegin(); it != list.cend(); ++it) {
+            sum += it->id;
+        }
+        return sum;
+    }
+
+    template <typename Load>
+    void Run(const string& name, const string& method, Load load) {
+        BenchmarkResult result;
+        result.name = name;
+        result.labels = {{"method", method}};
+        result.size = size_;
+        result.operations = size_;
+        result.total_ns = MeasureNs([&] {
+            DoNotOptimize(load());
+        });
+        report_.Add(std::move(result));
+    }
+
+    BenchmarkReport& report_;
+    size_t size_;
+    filesystem::path directory_;
+    filesystem::path text_path_;
+    filesystem::path binary_path_;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("serialization",
+                           ParseBenchmarkOptions(argc, argv));
+    const vector<size_t> sizes =
+        report.GetOptions().quick ? vector<size_t>{1'000, 100'000}
+                                  : vector<size_t>{1'000, 100'000,
+                                                   4'000'000};
+    for (const size_t size : sizes) {
+        SerializationBenchmarks(report, size).RunAll();
+    }
+    return report.Finish();
+}
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "../single-linked-list.h"
+#include "../small-single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Счётчики выделений памяти всей программы: по ним видно, сколько
+// памяти в куче занимают узлы множества маленьких списков
+atomic<size_t> g_allocations{0};
+atomic<size_t> g_allocated_bytes{0};
+
+}  // namespace
+
+void* operator new(size_t size) {
+    g_allocations.fetch_add(1, memory_order_relaxed);
+    g_allocated_bytes.fetch_add(size, memory_order_relaxed);
+    if (void* ptr = malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+namespace {
+
+// Строит count списков по length элементов, обходит их и разрушает.
+// Операция — один элемент. Метки allocs_per_list и bytes_per_list
+// показывают объём памяти: объект списка плюс запрошенное из кучи
+template <typename List>
+class SmallListBenchmarks {
+public:
+    SmallListBenchmarks(BenchmarkReport& report, string container,
+                        size_t count)
+        : report_(report)
+        , container_(std::move(container))
+        , count_(count) {
+    }
+
+    void Run(size_t length) {
+        vector<List> lists(count_);
+        const size_t allocations_before = g_allocations.load();
+        const size_t bytes_before = g_allocated_bytes.load();
+
+        BenchmarkResult build;
+        build.name = "Build";
+        build.total_ns = MeasureNs([&] {
+            for (List& list : lists) {
+                for (size_t i = 0; i < length; ++i) {
+                    list.PushBack(static_cast<int>(i));
+                }
+            }
+        });
+        const size_t allocations = g_allocations.load() - allocations_before;
+        const size_t heap_bytes = g_allocated_bytes.load() - bytes_before;
+
+        BenchmarkResult iterate;
+        iterate.name = "Iterate";
+        iterate.total_ns = MeasureNs([&] {
+            int64_t sum = 0;
+            for (const List& list : lists) {
+                for (const int value : list) {
+                    sum += value;
+                }
+            }
+            DoNotOptimize(sum);
+        });
+
+        BenchmarkResult destroy;
+        destroy.name = "Destroy";
+        destroy.total_ns = MeasureNs([&] {
+            lists.clear();
+        });
+
+        const double per_list = static_cast<double>(count_);
+        for (BenchmarkResult* result : {&build, &iterate, &destroy}) {
+            result->labels = {
+                {"container", container_},
+                {"length", to_string(length)},
+                {"allocs_per_list",
+                 to_string(static_cast<double>(allocations) / per_list)},
+                {"bytes_per_list",
+                 to_string(sizeof(List) +
+                           static_cast<double>(heap_bytes) / per_list)}};
+            result->size = length;
+            result->operations = max<size_t>(1, length) * count_;
+            report_.Add(std::move(*result));
+        }
+    }
+
+private:
+    BenchmarkReport& report_;
+    string container_;
+    size_t count_;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("small", ParseBenchmarkOptions(argc, argv));
+    const bool quick = report.GetOptions().quick;
+    const size_t count = quick ? 10'000 : 1'000'000;
+    for (const size_t length : {0, 1, 2, 4, 8}) {
+        SmallListBenchmarks<SingleLinkedList<int>>(report, "list", count)
+            .Run(length);
+        SmallListBenchmarks<SmallSingleLinkedList<int, 4>>(report, "small4",
+                                                            count)
+            .Run(length);
+    }
+    return report.Finish();
+}
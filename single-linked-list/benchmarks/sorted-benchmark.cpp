@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../single-linked-list.h"
+#include "../sorted-single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Отсортированный SingleLinkedList, в котором позиция ищется
+// линейным проходом, — вариант, с которым сравнивается индекс
+class LinearSortedList {
+public:
+    explicit LinearSortedList(const vector<int>& sorted)
+        : list_(sorted.begin(), sorted.end()) {
+    }
+
+    void Insert(int value) {
+        auto prev = list_.cbefore_begin();
+        for (auto it = list_.cbegin(); it != list_.cend() && *it < value;
+             ++it) {
+            prev = it;
+        }
+        list_.InsertAfter(prev, value);
+    }
+
+    bool Contains(int value) const {
+        for (const int element : list_) {
+            if (!(element < value)) {
+                return element == value;
+            }
+        }
+        return false;
+    }
+
+private:
+    SingleLinkedList<int> list_;
+};
+
+class SkipSortedList {
+public:
+    explicit SkipSortedList(const vector<int>& sorted)
+        : list_(sorted.begin(), sorted.end()) {
+    }
+
+    void Insert(int value) {
+        list_.Insert(value);
+    }
+
+    bool Contains(int value) const {
+        return list_.Contains(value);
+    }
+
+private:
+    SortedSingleLinkedList<int> list_;
+};
+
+// Строит отсортированный список из size случайных значений и
+// выполняет operations вставок и поисков случайных значений.
+// Операция — одна вставка либо один поиск
+template <typename List>
+void Run(BenchmarkReport& report, const string& container,
+         const vector<int>& sorted, size_t operations) {
+    mt19937 generator(7);
+    uniform_int_distribution<int> distribution(0, 1 << 30);
+    vector<int> values(operations);
+    for (int& value : values) {
+        value = distribution(generator);
+    }
+    List list(sorted);
+
+    BenchmarkResult find;
+    find.name = "Find";
+    find.total_ns = MeasureNs([&] {
+        size_t found = 0;
+        for (const int value : values) {
+            found += list.Contains(value);
+        }
+        DoNotOptimize(found);
+    });
+
+    BenchmarkResult insert;
+    insert.name = "Insert";
+    insert.total_ns = MeasureNs([&] {
+        for (const int value : values) {
+            list.Insert(value);
+        }
+    });
+
+    for (BenchmarkResult* result : {&find, &insert}) {
+        result->labels = {{"container", container}};
+        result->size = sorted.size();
+        result->operations = operations;
+        report.Add(std::move(*result));
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("sorted", ParseBenchmarkOptions(argc, argv));
+    const bool quick = report.GetOptions().quick;
+    const vector<size_t> sizes = quick
+        ? vector<size_t>{10'000, 100'000}
+        : vector<size_t>{100'000, 1'000'000, 10'000'000};
+    const size_t operations = quick ? 10'000 : 100'000;
+    for (const size_t size : sizes) {
+        mt19937 generator(42);
+        uniform_int_distribution<int> distribution(0, 1 << 30);
+        vector<int> sorted(size);
+        for (int& value : sorted) {
+            value = distribution(generator);
+        }
+        sort(sorted.begin(), sorted.end());
+        Run<SkipSortedList>(report, "skip_list", sorted, operations);
+        // Линейный поиск проходит в среднем половину списка, поэтому
+        // число операций ограничено, чтобы замер занимал секунды
+        Run<LinearSortedList>(
+            report, "linear", sorted,
+            clamp<size_t>(100'000'000 / size, 10, operations));
+    }
+    return report.Finish();
+}
@@ -0,0 +1,64 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Создаёт workers списков по items_per_worker элементов, как если
+// бы каждый поток-обработчик собрал свою часть результата
+vector<SingleLinkedList<int64_t>> MakeWorkerResults(size_t workers,
+                                                    size_t items_per_worker) {
+    vector<SingleLinkedList<int64_t>> results(workers);
+    for (size_t w = 0; w < workers; ++w) {
+        for (size_t i = 0; i < items_per_worker; ++i) {
+            results[w].PushBack(static_cast<int64_t>(w * items_per_worker + i));
+        }
+    }
+    return results;
+}
+
+// Объединяет результаты копированием каждого элемента либо
+// перецеплением узлов. Операция — объединение одного списка
+void RunMerge(BenchmarkReport& report, const string& method, size_t workers,
+              size_t items_per_worker) {
+    auto results = MakeWorkerResults(workers, items_per_worker);
+    SingleLinkedList<int64_t> merged;
+    BenchmarkResult result;
+    result.name = "Concatenate";
+    result.labels = {{"method", method}};
+    result.size = items_per_worker;
+    result.operations = workers;
+    result.total_ns = MeasureNs([&] {
+        for (auto& part : results) {
+            if (method == "copy") {
+                for (const int64_t value : part) {
+                    merged.PushBack(value);
+                }
+            } else {
+                merged.Append(std::move(part));
+            }
+        }
+    });
+    DoNotOptimize(merged.GetSize());
+    report.Add(std::move(result));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("splice", ParseBenchmarkOptions(argc, argv));
+    constexpr size_t kWorkers = 16;
+    const vector<size_t> sizes =
+        report.GetOptions().quick ? vector<size_t>{100, 10'000}
+                                  : vector<size_t>{100, 10'000, 1'000'000};
+    for (const size_t items : sizes) {
+        RunMerge(report, "copy", kWorkers, items);
+        RunMerge(report, "splice", kWorkers, items);
+    }
+    return report.Finish();
+}
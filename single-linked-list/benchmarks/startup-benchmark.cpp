@@ -0,0 +1,98 @@
+#include <array>
+#include <cstddef>
+#include <string>
+
+#include "../single-linked-list.h"
+#include "../static-single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Таблица, из которой при запуске строится список для поиска
+constexpr size_t kTableSize = 64;
+
+constexpr array<int, kTableSize> MakeTable() {
+    array<int, kTableSize> table{};
+    for (size_t i = 0; i < kTableSize; ++i) {
+        table[i] = static_cast<int>(i * 7 + 3);
+    }
+    return table;
+}
+
+constexpr array<int, kTableSize> kTable = MakeTable();
+
+template <typename List>
+constexpr List MakeList(const array<int, kTableSize>& table) {
+    List list;
+    for (const int value : table) {
+        list.PushBack(value);
+    }
+    return list;
+}
+
+// Список, целиком построенный компилятором
+constexpr auto kCompiledList =
+    MakeList<StaticSingleLinkedList<int, kTableSize>>(kTable);
+
+// Сравнивает стоимость подготовки списка для поиска при запуске:
+// построение SingleLinkedList с выделением узлов, построение
+// StaticSingleLinkedList во время выполнения и готовый constexpr
+// список. Операция — подготовка списка и один поиск в нём
+class StartupBenchmarks {
+public:
+    StartupBenchmarks(BenchmarkReport& report, size_t repeats)
+        : report_(report)
+        , repeats_(repeats) {
+    }
+
+    // Таблица и искомое значение лежат в изменяемых полях, чтобы
+    // компилятор не построил список и не выполнил поиск заранее
+    void RunAll() {
+        Run("runtime_list", [this] {
+            const auto list = MakeList<SingleLinkedList<int>>(table_);
+            return list.Contains(key_);
+        });
+        Run("runtime_static", [this] {
+            const auto list =
+                MakeList<StaticSingleLinkedList<int, kTableSize>>(table_);
+            return list.Contains(key_);
+        });
+        Run("constexpr_static", [this] {
+            return kCompiledList.Contains(key_);
+        });
+    }
+
+private:
+    template <typename Measure>
+    void Run(const string& mode, Measure measure) {
+        BenchmarkResult result;
+        result.name = "BuildAndFind";
+        result.labels = {{"mode", mode}};
+        result.size = kTableSize;
+        result.total_ns = MeasureNs([&] {
+            for (size_t r = 0; r < repeats_; ++r) {
+                DoNotOptimize(table_);
+                DoNotOptimize(key_);
+                DoNotOptimize(measure());
+            }
+        });
+        result.operations = repeats_;
+        report_.Add(std::move(result));
+    }
+
+    BenchmarkReport& report_;
+    size_t repeats_;
+    array<int, kTableSize> table_ = kTable;
+    int key_ = kTable.back();
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("startup", ParseBenchmarkOptions(argc, argv));
+    const size_t repeats = report.GetOptions().quick ? 10'000 : 1'000'000;
+    StartupBenchmarks(report, repeats).RunAll();
+    return report.Finish();
+}
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "../node-pool.h"
+#include "../single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+// Показания счётчика тактов процессора. Там, где его нет, вместо
+// тактов возвращаются наносекунды
+uint64_t ReadCycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(
+        chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+// Работа над элементом: несколько раундов перемешивания, около
+// двадцати тактов, не зависящих от памяти
+uint64_t Mix(uint64_t value) {
+    for (int round = 0; round < 4; ++round) {
+        value ^= value >> 29;
+        value *= 0xbf58476d1ce4e5b9ULL;
+    }
+    return value;
+}
+
+// Список, узлы которого связаны в случайном порядке относительно
+// их расположения в памяти: узлы выделяются подряд со значениями
+// случайной перестановки, а Sort перецепляет их по значению
+SingleLinkedList<uint64_t> MakeScatteredList(size_t size) {
+    vector<uint64_t> values(size);
+    iota(values.begin(), values.end(), uint64_t{0});
+    shuffle(values.begin(), values.end(), mt19937_64(42));
+    SingleLinkedList<uint64_t> list(values.begin(), values.end());
+    list.Sort();
+    return list;
+}
+
+// Список, узлы которого лежат в кусках NodePool в порядке обхода
+SingleLinkedList<uint64_t, PoolAllocator<uint64_t>> MakePooledList(
+    size_t size) {
+    SingleLinkedList<uint64_t, PoolAllocator<uint64_t>> list;
+    for (size_t i = 0; i < size; ++i) {
+        list.PushBack(i);
+    }
+    return list;
+}
+
+// Обходит list тремя способами: итераторами, ForEachPrefetched и
+// ForEachBatch. Операция — один элемент. Метка cycles_per_element
+// показывает такты процессора на элемент.
+// Если задана table, работа над элементом — чтение случайной ячейки
+// таблицы, и добавляется режим prefetch-hook, запрашивающий эту ячейку
+// заранее через адресный хук ForEachPrefetched
+template <typename List>
+void RunTraversals(BenchmarkReport& report, const string& layout,
+                   const string& work, List& list, bool mix,
+                   const vector<uint64_t>* table = nullptr) {
+    auto cell = [table](uint64_t value) {
+        return &(*table)[Mix(value) & (table->size() - 1)];
+    };
+    auto process = [mix, table, &cell](uint64_t value) {
+        if (table != nullptr) {
+            return *cell(value);
+        }
+        return mix ? Mix(value) : value;
+    };
+    auto run = [&](const string& mode, auto traverse) {
+        uint64_t sum = 0;
+        uint64_t cycles = ReadCycles();
+        BenchmarkResult result;
+        result.name = "Traverse";
+        result.total_ns = MeasureNs([&] {
+            traverse(sum);
+        });
+        cycles = ReadCycles() - cycles;
+        DoNotOptimize(sum);
+        result.labels = {
+            {"layout", layout},
+            {"work", work},
+            {"mode", mode},
+            {"cycles_per_element",
+             to_string(static_cast<double>(cycles) /
+                       static_cast<double>(list.GetSize()))}};
+        result.size = list.GetSize();
+        result.operations = list.GetSize();
+        report.Add(std::move(result));
+    };
+
+    run("iterator", [&](uint64_t& sum) {
+        for (const uint64_t value : list) {
+            sum += process(value);
+        }
+    });
+    run("window", [&](uint64_t& sum) {
+        list.ForEachPrefetched([&](const uint64_t value) {
+            sum += process(value);
+        });
+    });
+    if (table != nullptr) {
+        run("window-hook", [&](uint64_t& sum) {
+            list.ForEachPrefetched(
+                [&](const uint64_t value) {
+                    sum += process(value);
+                },
+                [&](const uint64_t value) -> const void* {
+                    return cell(value);
+                });
+        });
+    }
+    run("batch", [&](uint64_t& sum) {
+        list.ForEachBatch([&](span<const uint64_t* const> values) {
+            for (const uint64_t* value : values) {
+                sum += process(*value);
+            }
+        });
+    });
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("traversal", ParseBenchmarkOptions(argc, argv));
+    const vector<size_t> sizes = report.GetOptions().quick
+        ? vector<size_t>{10'000, 100'000}
+        : vector<size_t>{100'000, 1'000'000, 10'000'000};
+    // Таблица для работы lookup заведомо больше кэша последнего уровня.
+    // Размер — степень двойки, чтобы индекс брался маской
+    vector<uint64_t> table(report.GetOptions().quick ? size_t{1} << 20
+                                                     : size_t{1} << 24);
+    iota(table.begin(), table.end(), uint64_t{0});
+    for (const size_t size : sizes) {
+        {
+            const auto list = MakeScatteredList(size);
+            RunTraversals(report, "scattered", "sum", list, false);
+            RunTraversals(report, "scattered", "mix", list, true);
+            RunTraversals(report, "scattered", "lookup", list, false,
+                          &table);
+        }
+        {
+            const auto list = MakePooledList(size);
+            RunTraversals(report, "pooled", "sum", list, false);
+            RunTraversals(report, "pooled", "mix", list, true);
+            RunTraversals(report, "pooled", "lookup", list, false, &table);
+        }
+    }
+    return report.Finish();
+}
@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../single-linked-list.h"
+#include "../unrolled-single-linked-list.h"
+#include "benchmark.h"
+
+using namespace std;
+
+namespace {
+
+template <typename List>
+List MakeList(size_t size) {
+    List list;
+    for (size_t i = 0; i < size; ++i) {
+        list.PushBack(static_cast<int64_t>(i));
+    }
+    return list;
+}
+
+// Замеряет обход списка через std::accumulate
+template <typename List>
+void RunAccumulate(BenchmarkReport& report, const string& layout,
+                   size_t size, size_t repeats) {
+    const List list = MakeList<List>(size);
+    BenchmarkResult result;
+    result.name = "Accumulate";
+    result.labels = {{"layout", layout}};
+    result.size = size;
+    result.operations = size * repeats;
+    result.total_ns = MeasureNs([&] {
+        for (size_t r = 0; r < repeats; ++r) {
+            DoNotOptimize(accumulate(list.begin(), list.end(), int64_t{0}));
+        }
+    });
+    report.Add(std::move(result));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkReport report("unrolled", ParseBenchmarkOptions(argc, argv));
+    const bool quick = report.GetOptions().quick;
+    const vector<size_t> sizes =
+        quick ? vector<size_t>{1'000, 100'000}
+              : vector<size_t>{1'000, 10'000, 100'000, 1'000'000, 10'000'000};
+    const size_t target_elements = quick ? 1'000'000 : 50'000'000;
+    for (const size_t size : sizes) {
+        const size_t repeats = max<size_t>(1, target_elements / size);
+        RunAccumulate<SingleLinkedList<int64_t>>(report, "node_per_element",
+                                                 size, repeats);
+        RunAccumulate<UnrolledSingleLinkedList<int64_t, 32>>(
+            report, "unrolled_32", size, repeats);
+    }
+    return report.Finish();
+}
@@ -0,0 +1,520 @@
+#pragma once
+
+#include <cassert>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "intrusive-single-linked-list.h"
+#include "single-linked-list.h"
+
+/*
+ * Очередь для передачи элементов между потоками и сопрограммами
+ * поверх SingleLinkedList: производители добавляют элементы в конец,
+ * потребители извлекают их из начала.
+ * Узел элемента создаётся и освобождается вне мьютекса, а под
+ * мьютексом узлы только перецепляются. PopFrontN отцепляет цепочку
+ * из нескольких узлов за один захват мьютекса, поэтому потребитель
+ * обрабатывает пачку элементов за одно пробуждение.
+ * Вместимость ограничивает число элементов в очереди: добавление в
+ * заполненную очередь ждёт, пока потребители не освободят место.
+ * Ожидать можно блокируя поток (PushBack, PopFront, PopFrontN) либо
+ * приостанавливая сопрограмму C++20:
+ *
+ *     std::optional<int> value = co_await channel.PopFrontAsync();
+ *
+ * Приостановленную сопрограмму возобновляет поток, который добавил
+ * для неё элемент, освободил для неё место или закрыл очередь.
+ * После Close добавление не выполняется, а извлечение возвращает
+ * оставшиеся элементы и затем сообщает о закрытии.
+ * При разрушении очереди её не должны ожидать ни потоки, ни
+ * сопрограммы
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
+class ChannelList {
+public:
+    using List = SingleLinkedList<Type, Allocator>;
+
+private:
+    // Сопрограмма, ожидающая элементы. Объект лежит в кадре
+    // сопрограммы, пока она приостановлена
+    struct PopWaiter {
+        explicit PopWaiter(size_t count, const Allocator& alloc)
+            : max_count(count)
+            , items(alloc) {
+        }
+
+        IntrusiveListHook hook;
+        std::coroutine_handle<> handle;
+        size_t max_count;
+        // Полученные элементы, пусто — очередь закрыта
+        List items;
+    };
+
+    // Сопрограмма, ожидающая места в очереди. Узел элемента создан
+    // заранее и при появлении места только перецепляется
+    struct PushWaiter {
+        explicit PushWaiter(List&& node)
+            : item(std::move(node)) {
+        }
+
+        IntrusiveListHook hook;
+        std::coroutine_handle<> handle;
+        List item;
+        bool accepted = false;
+    };
+
+    using PopWaiters = IntrusiveSingleLinkedList<PopWaiter, &PopWaiter::hook>;
+    using PushWaiters =
+        IntrusiveSingleLinkedList<PushWaiter, &PushWaiter::hook>;
+
+    // Сопрограммы, которые нужно возобновить после освобождения
+    // мьютекса
+    struct ReadyWaiters {
+        void ResumeAll() {
+            // Возобновлённая сопрограмма может разрушить свой объект
+            // ожидания, поэтому он отцепляется заранее
+            while (!pops.IsEmpty()) {
+                PopWaiter& waiter = *pops.begin();
+                pops.PopFront();
+                waiter.handle.resume();
+            }
+            while (!pushes.IsEmpty()) {
+                PushWaiter& waiter = *pushes.begin();
+                pushes.PopFront();
+                waiter.handle.resume();
+            }
+        }
+
+        PopWaiters pops;
+        PushWaiters pushes;
+    };
+
+public:
+    // Вместимость очереди без ограничения
+    static constexpr size_t kUnbounded = std::numeric_limits<size_t>::max();
+
+    // Результат co_await PopFrontAsync(): первый элемент очереди либо
+    // std::nullopt, если очередь закрыта и пуста
+    class PopAwaiter {
+        friend class ChannelList;
+
+        explicit PopAwaiter(ChannelList& channel)
+            : channel_(channel)
+            , waiter_(1, channel.list_.get_allocator()) {
+        }
+
+    public:
+        PopAwaiter(const PopAwaiter&) = delete;
+        PopAwaiter& operator=(const PopAwaiter&) = delete;
+
+        [[nodiscard]] bool await_ready() const noexcept {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            return channel_.SuspendPop(waiter_, handle);
+        }
+
+        std::optional<Type> await_resume() {
+            if (waiter_.items.IsEmpty()) {
+                return std::nullopt;
+            }
+            return std::optional<Type>(std::move(*waiter_.items.begin()));
+        }
+
+    private:
+        ChannelList& channel_;
+        PopWaiter waiter_;
+    };
+
+    // Результат co_await PopFrontNAsync(n): от 1 до n первых элементов
+    // очереди либо пустой список, если очередь закрыта и пуста
+    class PopNAwaiter {
+        friend class ChannelList;
+
+        PopNAwaiter(ChannelList& channel, size_t max_count)
+            : channel_(channel)
+            , waiter_(max_count, channel.list_.get_allocator()) {
+        }
+
+    public:
+        PopNAwaiter(const PopNAwaiter&) = delete;
+        PopNAwaiter& operator=(const PopNAwaiter&) = delete;
+
+        [[nodiscard]] bool await_ready() const noexcept {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            return channel_.SuspendPop(waiter_, handle);
+        }
+
+        List await_resume() {
+            return std::move(waiter_.items);
+        }
+
+    private:
+        ChannelList& channel_;
+        PopWaiter waiter_;
+    };
+
+    // Результат co_await PushBackAsync(value): true, если элемент
+    // добавлен, и false, если очередь закрыта
+    class PushAwaiter {
+        friend class ChannelList;
+
+        PushAwaiter(ChannelList& channel, List&& item)
+            : channel_(channel)
+            , waiter_(std::move(item)) {
+        }
+
+    public:
+        PushAwaiter(const PushAwaiter&) = delete;
+        PushAwaiter& operator=(const PushAwaiter&) = delete;
+
+        [[nodiscard]] bool await_ready() const noexcept {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            return channel_.SuspendPush(waiter_, handle);
+        }
+
+        bool await_resume() const noexcept {
+            return waiter_.accepted;
+        }
+
+    private:
+        ChannelList& channel_;
+        PushWaiter waiter_;
+    };
+
+    explicit ChannelList(size_t capacity = kUnbounded,
+                         const Allocator& alloc = Allocator())
+        : list_(alloc)
+        , capacity_(capacity) {
+        assert(capacity > 0);
+    }
+
+    ChannelList(const ChannelList&) = delete;
+    ChannelList& operator=(const ChannelList&) = delete;
+
+    ~ChannelList() {
+        assert(pop_waiters_.IsEmpty() && push_waiters_.IsEmpty());
+    }
+
+    // Возвращает наибольшее число элементов в очереди
+    [[nodiscard]] size_t GetCapacity() const noexcept {
+        return capacity_;
+    }
+
+    // Возвращает число элементов в очереди в момент вызова
+    [[nodiscard]] size_t GetSize() const {
+        std::lock_guard guard(mutex_);
+        return list_.GetSize();
+    }
+
+    // Сообщает, была ли очередь пуста в момент вызова
+    [[nodiscard]] bool IsEmpty() const {
+        return GetSize() == 0;
+    }
+
+    // Сообщает, закрыта ли очередь
+    [[nodiscard]] bool IsClosed() const {
+        std::lock_guard guard(mutex_);
+        return closed_;
+    }
+
+    /*
+     * Добавляет элемент, созданный из args, в конец очереди. Если
+     * очередь заполнена, ждёт освобождения места.
+     * Возвращает false, если очередь закрыта: тогда элемент не
+     * добавляется
+     */
+    template <typename... Args>
+    bool EmplaceBack(Args&&... args) {
+        List item = MakeItem(std::forward<Args>(args)...);
+        ReadyWaiters ready;
+        {
+            std::unique_lock lock(mutex_);
+            ++push_sleepers_;
+            not_full_.wait(lock, [this] {
+                return closed_ || !IsFull();
+            });
+            --push_sleepers_;
+            if (closed_) {
+                return false;
+            }
+            list_.Append(std::move(item));
+            Dispatch(ready);
+        }
+        ready.ResumeAll();
+        return true;
+    }
+
+    bool PushBack(const Type& value) {
+        return EmplaceBack(value);
+    }
+
+    bool PushBack(Type&& value) {
+        return EmplaceBack(std::move(value));
+    }
+
+    // Добавляет элемент, созданный из args, если в очереди есть место
+    // и она не закрыта. Иначе возвращает false, а созданный элемент
+    // уничтожается
+    template <typename... Args>
+    bool TryEmplaceBack(Args&&... args) {
+        List item = MakeItem(std::forward<Args>(args)...);
+        return TryAppend(item);
+    }
+
+    bool TryPushBack(const Type& value) {
+        return TryEmplaceBack(value);
+    }
+
+    // Если элемент не добавлен, value получает его обратно
+    bool TryPushBack(Type&& value) {
+        List item = MakeItem(std::move(value));
+        if (TryAppend(item)) {
+            return true;
+        }
+        value = std::move(*item.begin());
+        return false;
+    }
+
+    // Извлекает первый элемент, дожидаясь его появления. Возвращает
+    // std::nullopt, если очередь закрыта и пуста
+    std::optional<Type> PopFront() {
+        return TakeValue(PopFrontN(1));
+    }
+
+    // Извлекает первый элемент, если очередь не пуста
+    std::optional<Type> TryPopFront() {
+        return TakeValue(TryPopFrontN(1));
+    }
+
+    /*
+     * Дожидается хотя бы одного элемента и отцепляет от 1 до
+     * max_count первых элементов одной цепочкой узлов.
+     * Возвращает пустой список, если очередь закрыта и пуста
+     */
+    List PopFrontN(size_t max_count) {
+        assert(max_count > 0);
+        List items(list_.get_allocator());
+        ReadyWaiters ready;
+        {
+            std::unique_lock lock(mutex_);
+            ++pop_sleepers_;
+            not_empty_.wait(lock, [this] {
+                return closed_ || !list_.IsEmpty();
+            });
+            --pop_sleepers_;
+            TakeFront(items, max_count);
+            Dispatch(ready);
+        }
+        ready.ResumeAll();
+        return items;
+    }
+
+    // Отцепляет до max_count первых элементов, не дожидаясь их
+    List TryPopFrontN(size_t max_count) {
+        assert(max_count > 0);
+        List items(list_.get_allocator());
+        ReadyWaiters ready;
+        {
+            std::lock_guard guard(mutex_);
+            TakeFront(items, max_count);
+            Dispatch(ready);
+        }
+        ready.ResumeAll();
+        return items;
+    }
+
+    // Ожидание первого элемента в сопрограмме: co_await PopFrontAsync()
+    [[nodiscard]] PopAwaiter PopFrontAsync() {
+        return PopAwaiter(*this);
+    }
+
+    // Ожидание пачки элементов в сопрограмме:
+    // co_await PopFrontNAsync(max_count)
+    [[nodiscard]] PopNAwaiter PopFrontNAsync(size_t max_count) {
+        assert(max_count > 0);
+        return PopNAwaiter(*this, max_count);
+    }
+
+    // Ожидание места для элемента в сопрограмме:
+    // co_await PushBackAsync(value)
+    [[nodiscard]] PushAwaiter PushBackAsync(const Type& value) {
+        return PushAwaiter(*this, MakeItem(value));
+    }
+
+    [[nodiscard]] PushAwaiter PushBackAsync(Type&& value) {
+        return PushAwaiter(*this, MakeItem(std::move(value)));
+    }
+
+    // Закрывает очередь и будит всех ожидающих. Повторный вызов
+    // ничего не делает
+    void Close() {
+        ReadyWaiters ready;
+        {
+            std::lock_guard guard(mutex_);
+            closed_ = true;
+            // Сопрограммы ждут элементов только в пустой очереди,
+            // поэтому получают пустой результат
+            while (!pop_waiters_.IsEmpty()) {
+                PopWaiter& waiter = *pop_waiters_.begin();
+                pop_waiters_.PopFront();
+                ready.pops.PushBack(waiter);
+            }
+            while (!push_waiters_.IsEmpty()) {
+                PushWaiter& waiter = *push_waiters_.begin();
+                push_waiters_.PopFront();
+                ready.pushes.PushBack(waiter);
+            }
+            not_empty_.notify_all();
+            not_full_.notify_all();
+        }
+        ready.ResumeAll();
+    }
+
+private:
+    template <typename... Args>
+    List MakeItem(Args&&... args) {
+        List item(list_.get_allocator());
+        item.EmplaceFront(std::forward<Args>(args)...);
+        return item;
+    }
+
+    // Перецепляет узел item в конец очереди без ожидания места.
+    // Если очередь заполнена или закрыта, item остаётся нетронутым
+    // и освобождается вызывающим уже вне мьютекса
+    bool TryAppend(List& item) {
+        ReadyWaiters ready;
+        {
+            std::lock_guard guard(mutex_);
+            if (closed_ || IsFull()) {
+                return false;
+            }
+            list_.Append(std::move(item));
+            Dispatch(ready);
+        }
+        ready.ResumeAll();
+        return true;
+    }
+
+    static std::optional<Type> TakeValue(List&& items) {
+        if (items.IsEmpty()) {
+            return std::nullopt;
+        }
+        return std::optional<Type>(std::move(*items.begin()));
+    }
+
+    bool IsFull() const noexcept {
+        return list_.GetSize() >= capacity_;
+    }
+
+    // Перецепляет в пустой список items до max_count первых узлов
+    // очереди. Вызывается под мьютексом
+    void TakeFront(List& items, size_t max_count) noexcept {
+        if (max_count >= list_.GetSize()) {
+            items.SpliceAfter(items.cbefore_begin(), list_);
+        } else {
+            items.SpliceAfter(items.cbefore_begin(), list_,
+                              list_.cbefore_begin(),
+                              std::next(list_.cbegin(), max_count));
+        }
+    }
+
+    /*
+     * Передаёт элементы приостановленным потребителям и место —
+     * приостановленным производителям, пока это возможно, затем будит
+     * по одному заблокированному потоку каждого вида, если ему есть
+     * что делать. Проснувшийся поток сам вызывает Dispatch, поэтому
+     * пробуждения идут по цепочке. Вызывается под мьютексом
+     */
+    void Dispatch(ReadyWaiters& ready) {
+        bool progress = true;
+        while (progress) {
+            progress = false;
+            while (!list_.IsEmpty() && !pop_waiters_.IsEmpty()) {
+                PopWaiter& waiter = *pop_waiters_.begin();
+                pop_waiters_.PopFront();
+                TakeFront(waiter.items, waiter.max_count);
+                ready.pops.PushBack(waiter);
+                progress = true;
+            }
+            while (!IsFull() && !push_waiters_.IsEmpty()) {
+                PushWaiter& waiter = *push_waiters_.begin();
+                push_waiters_.PopFront();
+                list_.Append(std::move(waiter.item));
+                waiter.accepted = true;
+                ready.pushes.PushBack(waiter);
+                progress = true;
+            }
+        }
+        if (pop_sleepers_ > 0 && !list_.IsEmpty()) {
+            not_empty_.notify_one();
+        }
+        if (push_sleepers_ > 0 && !IsFull()) {
+            not_full_.notify_one();
+        }
+    }
+
+    // Возвращает true, если сопрограмму нужно приостановить
+    bool SuspendPop(PopWaiter& waiter, std::coroutine_handle<> handle) {
+        ReadyWaiters ready;
+        {
+            std::lock_guard guard(mutex_);
+            if (list_.IsEmpty() && !closed_) {
+                waiter.handle = handle;
+                pop_waiters_.PushBack(waiter);
+                return true;
+            }
+            TakeFront(waiter.items, waiter.max_count);
+            Dispatch(ready);
+        }
+        ready.ResumeAll();
+        return false;
+    }
+
+    bool SuspendPush(PushWaiter& waiter, std::coroutine_handle<> handle) {
+        ReadyWaiters ready;
+        {
+            std::lock_guard guard(mutex_);
+            if (closed_) {
+                return false;
+            }
+            if (IsFull()) {
+                waiter.handle = handle;
+                push_waiters_.PushBack(waiter);
+                return true;
+            }
+            list_.Append(std::move(waiter.item));
+            waiter.accepted = true;
+            Dispatch(ready);
+        }
+        ready.ResumeAll();
+        return false;
+    }
+
+    mutable std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    List list_;
+    size_t capacity_;
+    bool closed_ = false;
+    // Число потоков, заблокированных в ожидании элементов и места.
+    // Без ожидающих уведомление не выполняется
+    size_t pop_sleepers_ = 0;
+    size_t push_sleepers_ = 0;
+    PopWaiters pop_waiters_;
+    PushWaiters push_waiters_;
+};
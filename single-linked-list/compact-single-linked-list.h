@@ -0,0 +1,682 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * Односвязный список с плотным хранением узлов.
+ * Узлы лежат в пуле из кусков, каждый следующий кусок вдвое больше
+ * предыдущего, и ссылаются друг на друга 32-битными номерами, а не
+ * указателями. Узел CompactSingleLinkedList<int32_t> занимает
+ * 8 байт вместо 16 у SingleLinkedList, а на каждый элемент не
+ * приходится отдельного выделения памяти со служебным заголовком.
+ * Куски не перемещаются при росте пула, поэтому ссылки и итераторы
+ * на элементы остаются действительными, пока элемент в списке, в том
+ * числе после обмена и перемещения списка: итератор ссылается на
+ * узел и на таблицу кусков пула, а не на объект списка. Как и у
+ * SingleLinkedList, before_begin() относится к самому объекту списка.
+ * Интерфейс повторяет SingleLinkedList: before_begin, InsertAfter,
+ * EmplaceAfter, EraseAfter, PopFront и однонаправленные итераторы.
+ * Перецепление узлов между списками не поддерживается: номера
+ * действуют только внутри своего пула. Удалённые узлы используются
+ * повторно, а память кусков возвращается при Clear и разрушении.
+ * Список вмещает не больше GetMaxSize() элементов, вставка сверх
+ * этого выбрасывает std::length_error
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
+class CompactSingleLinkedList {
+    // Номер, означающий отсутствие следующего узла
+    static constexpr uint32_t kNone = UINT32_MAX;
+
+    // Значение создаётся в узле только на время нахождения элемента
+    // в списке, поэтому Type не обязан иметь конструктор по умолчанию.
+    // Узлы пула не инициализируются при выделении куска
+    struct Node {
+        Node() noexcept {
+        }
+
+        explicit Node(uint32_t next_index) noexcept
+            : next(next_index) {
+        }
+
+        ~Node() {
+        }
+
+        union {
+            Type value;
+        };
+        uint32_t next;
+    };
+
+    using NodeAllocator =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+    // Размер первого куска пула — 2^kFirstChunkShift узлов
+    static constexpr uint32_t kFirstChunkShift = 4;
+    // Количество кусков, которых хватает на все 32-битные номера
+    static constexpr uint32_t kMaxChunks = 32 - kFirstChunkShift + 1;
+
+    // Шаблон класса «Базовый Итератор».
+    // Итератор на элемент хранит узел и таблицу кусков пула, которая
+    // не перемещается ни при росте пула, ни при обмене списков.
+    // Итератор before_begin() хранит вместо таблицы сам список: до
+    // первой вставки таблицы ещё нет
+    // ValueType — совпадает с Type (для Iterator) либо с
+    // const Type (для ConstIterator)
+    template <typename ValueType>
+    class BasicIterator {
+        friend class CompactSingleLinkedList;
+
+        BasicIterator(Node* node, Node* const* chunks,
+                      const CompactSingleLinkedList* list = nullptr) noexcept
+            : node_(node)
+            , chunks_(chunks)
+            , list_(list) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        // Конвертирующий конструктор/конструктор копирования
+        BasicIterator(const BasicIterator<Type>& other) noexcept
+            : node_(other.node_)
+            , chunks_(other.chunks_)
+            , list_(other.list_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        // Итераторы end() всех списков равны, поэтому сравнивается
+        // только узел
+        [[nodiscard]] bool operator==
+            (const BasicIterator<const Type>& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
+
+        [[nodiscard]] bool operator!=
+            (const BasicIterator<const Type>& rhs) const noexcept {
+            return node_ != rhs.node_;
+        }
+
+        [[nodiscard]] bool operator==
+            (const BasicIterator<Type>& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
+
+        [[nodiscard]] bool operator!=
+            (const BasicIterator<Type>& rhs) const noexcept {
+            return node_ != rhs.node_;
+        }
+
+        BasicIterator& operator++() noexcept {
+            assert(node_ != nullptr);
+            if (list_ != nullptr) {
+                chunks_ = list_->chunks_.data();
+                list_ = nullptr;
+            }
+            node_ = node_->next == kNone ? nullptr
+                                         : &LocateNode(chunks_, node_->next);
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto old_value(*this);
+            ++(*this);
+            return old_value;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(node_ != nullptr && list_ == nullptr);
+            return node_->value;
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            return &**this;
+        }
+
+    private:
+        Node* node_ = nullptr;
+        Node* const* chunks_ = nullptr;
+        const CompactSingleLinkedList* list_ = nullptr;
+    };
+
+public:
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using allocator_type = Allocator;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    CompactSingleLinkedList() = default;
+
+    explicit CompactSingleLinkedList(const Allocator& alloc)
+        : alloc_(alloc) {
+    }
+
+    template <typename InputIt>
+    CompactSingleLinkedList(InputIt first, InputIt last,
+                            const Allocator& alloc = Allocator())
+        : alloc_(alloc) {
+        AssignNew(first, last);
+    }
+
+    CompactSingleLinkedList(std::initializer_list<Type> values,
+                            const Allocator& alloc = Allocator())
+        : CompactSingleLinkedList(values.begin(), values.end(), alloc) {
+    }
+
+    // Копия хранит элементы в пуле подряд в порядке обхода и не
+    // наследует свободные узлы оригинала
+    CompactSingleLinkedList(const CompactSingleLinkedList& other)
+        : alloc_(NodeAllocatorTraits::select_on_container_copy_construction(
+              other.alloc_)) {
+        AssignNew(other.begin(), other.end(), other.GetSize());
+    }
+
+    // Куски пула переходят к новому списку целиком
+    CompactSingleLinkedList(CompactSingleLinkedList&& other) noexcept
+        : alloc_(std::move(other.alloc_)) {
+        SwapContents(other);
+    }
+
+    /*
+     * Копирующее присваивание собирает копию rhs во временном списке
+     * и забирает её, поэтому при исключении список не меняется.
+     * Аллокатор rhs перенимается, только если этого требует
+     * propagate_on_container_copy_assignment
+     */
+    CompactSingleLinkedList& operator=(const CompactSingleLinkedList& rhs) {
+        if (this == &rhs) {
+            return *this;
+        }
+        if constexpr (NodeAllocatorTraits::
+                      propagate_on_container_copy_assignment::value) {
+            if (alloc_ != rhs.alloc_) {
+                Clear();
+            }
+            alloc_ = rhs.alloc_;
+        }
+        CompactSingleLinkedList tmp(rhs.begin(), rhs.end(), get_allocator());
+        SwapContents(tmp);
+        return *this;
+    }
+
+    // Перемещающее присваивание. Если аллокаторы позволяют, пул rhs
+    // забирается за время O(1). Иначе элементы rhs перемещаются в
+    // новые узлы, выделенные аллокатором этого списка
+    CompactSingleLinkedList& operator=(CompactSingleLinkedList&& rhs) noexcept(
+        NodeAllocatorTraits::propagate_on_container_move_assignment::value ||
+        NodeAllocatorTraits::is_always_equal::value) {
+        if (this == &rhs) {
+            return *this;
+        }
+        if constexpr (NodeAllocatorTraits::
+                      propagate_on_container_move_assignment::value) {
+            Clear();
+            alloc_ = std::move(rhs.alloc_);
+            SwapContents(rhs);
+        } else {
+            if (alloc_ == rhs.alloc_) {
+                Clear();
+                SwapContents(rhs);
+            } else {
+                CompactSingleLinkedList tmp(get_allocator());
+                tmp.Reserve(rhs.GetSize());
+                for (auto it = rhs.begin(); it != rhs.end(); ++it) {
+                    tmp.PushBack(std::move(*it));
+                }
+                rhs.Clear();
+                SwapContents(tmp);
+            }
+        }
+        return *this;
+    }
+
+    ~CompactSingleLinkedList() {
+        Clear();
+    }
+
+    // Обменивает содержимое списков за время O(1)
+    // Аллокаторы обмениваются, только если этого требует
+    // propagate_on_container_swap, иначе они должны быть равны
+    void swap(CompactSingleLinkedList& other) noexcept {
+        if constexpr (NodeAllocatorTraits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(alloc_, other.alloc_);
+        } else {
+            assert(alloc_ == other.alloc_);
+        }
+        SwapContents(other);
+    }
+
+    // Возвращает копию аллокатора, которым создан список
+    [[nodiscard]] allocator_type get_allocator() const noexcept {
+        return allocator_type(alloc_);
+    }
+
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return MakeIterator(&head_);
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return MakeIterator(&head_);
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    [[nodiscard]] Iterator begin() noexcept {
+        return MakeIterator(FirstNode());
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator{nullptr, nullptr};
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return MakeIterator(FirstNode());
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator{nullptr, nullptr};
+    }
+
+    // Возвращает итератор на последний элемент, а для пустого
+    // списка — before_begin()
+    [[nodiscard]] Iterator before_end() noexcept {
+        return MakeIterator(last_);
+    }
+
+    [[nodiscard]] ConstIterator cbefore_end() const noexcept {
+        return MakeIterator(last_);
+    }
+
+    [[nodiscard]] ConstIterator before_end() const noexcept {
+        return cbefore_end();
+    }
+
+    // Возвращает количество элементов в списке за время O(1)
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Сообщает, пустой ли список за время O(1)
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Возвращает наибольшее количество элементов в списке
+    [[nodiscard]] static constexpr size_t GetMaxSize() noexcept {
+        return kNone;
+    }
+
+    // Возвращает количество узлов во всех кусках пула
+    [[nodiscard]] size_t GetCapacity() const noexcept {
+        return ChunkStart(static_cast<uint32_t>(chunks_.size()));
+    }
+
+    // Возвращает объём памяти, которую занимает список: объект и все
+    // куски пула, включая свободные узлы
+    [[nodiscard]] size_t GetAllocatedBytes() const noexcept {
+        return sizeof(*this) + GetCapacity() * sizeof(Node) +
+               chunks_.capacity() * sizeof(Node*);
+    }
+
+    // Возвращает GetAllocatedBytes() в расчёте на один элемент
+    [[nodiscard]] double GetBytesPerElement() const noexcept {
+        return IsEmpty() ? 0.0
+                         : static_cast<double>(GetAllocatedBytes()) /
+                               static_cast<double>(size_);
+    }
+
+    // Выделяет куски пула, пока в нём не окажется хотя бы n узлов
+    void Reserve(size_t n) {
+        if (n > GetMaxSize()) {
+            throw std::length_error("CompactSingleLinkedList is too large");
+        }
+        while (GetCapacity() < n) {
+            AllocateChunk();
+        }
+    }
+
+    // Возвращает итератор на первый элемент, равный value, либо end()
+    [[nodiscard]] Iterator Find(const Type& value) {
+        return MakeIterator(FindNode(value));
+    }
+
+    [[nodiscard]] ConstIterator Find(const Type& value) const {
+        return MakeIterator(FindNode(value));
+    }
+
+    // Сообщает, есть ли в списке элемент, равный value
+    [[nodiscard]] bool Contains(const Type& value) const {
+        return FindNode(value) != nullptr;
+    }
+
+    // Вставляет элемент value в начало списка за время O(1)
+    void PushFront(const Type& value) {
+        EmplaceAfter(cbefore_begin(), value);
+    }
+
+    void PushFront(Type&& value) {
+        EmplaceAfter(cbefore_begin(), std::move(value));
+    }
+
+    template <typename... Args>
+    reference EmplaceFront(Args&&... args) {
+        return *EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...);
+    }
+
+    // Вставляет элемент value в конец списка за время O(1)
+    void PushBack(const Type& value) {
+        EmplaceAfter(cbefore_end(), value);
+    }
+
+    void PushBack(Type&& value) {
+        EmplaceAfter(cbefore_end(), std::move(value));
+    }
+
+    template <typename... Args>
+    reference EmplaceBack(Args&&... args) {
+        return *EmplaceAfter(cbefore_end(), std::forward<Args>(args)...);
+    }
+
+    /*
+     * Вставляет элемент value после элемента, на который указывает
+     * pos. Возвращает итератор на вставленный элемент.
+     * Если при создании элемента будет выброшено исключение, список
+     * останется в прежнем состоянии
+     */
+    Iterator InsertAfter(ConstIterator pos, const Type& value) {
+        return EmplaceAfter(pos, value);
+    }
+
+    Iterator InsertAfter(ConstIterator pos, Type&& value) {
+        return EmplaceAfter(pos, std::move(value));
+    }
+
+    // Вставляет элементы [first, last) после pos. Возвращает итератор
+    // на последний вставленный элемент либо pos, если диапазон пуст
+    template <typename InputIt>
+    Iterator InsertAfter(ConstIterator pos, InputIt first, InputIt last) {
+        Iterator inserted = MakeIterator(pos.node_);
+        for (; first != last; ++first) {
+            inserted = EmplaceAfter(inserted, *first);
+        }
+        return inserted;
+    }
+
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
+        assert(pos.node_ != nullptr);
+        const uint32_t index = TakeFreeIndex();
+        Node& node = NodeAt(index);
+        try {
+            NodeAllocatorTraits::construct(alloc_, std::addressof(node.value),
+                                           std::forward<Args>(args)...);
+        } catch (...) {
+            ReleaseIndex(index);
+            throw;
+        }
+        node.next = pos.node_->next;
+        pos.node_->next = index;
+        if (node.next == kNone) {
+            last_ = &node;
+        }
+        ++size_;
+        return MakeIterator(&node);
+    }
+
+    void PopFront() noexcept {
+        assert(!IsEmpty());
+        EraseAfter(cbefore_begin());
+    }
+
+    /*
+     * Удаляет элемент, следующий за pos.
+     * Возвращает итератор на элемент, следующий за удалённым
+     */
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        assert(pos.node_ != nullptr && pos.node_->next != kNone);
+        const uint32_t erased = pos.node_->next;
+        Node& node = NodeAt(erased);
+        pos.node_->next = node.next;
+        if (node.next == kNone) {
+            last_ = pos.node_;
+        }
+        NodeAllocatorTraits::destroy(alloc_, std::addressof(node.value));
+        ReleaseIndex(erased);
+        --size_;
+        return MakeIterator(NextNode(*pos.node_));
+    }
+
+    // Очищает список и возвращает память пула за время O(N)
+    void Clear() noexcept {
+        for (Node* node = FirstNode(); node != nullptr;) {
+            Node* next = NextNode(*node);
+            NodeAllocatorTraits::destroy(alloc_, std::addressof(node->value));
+            node = next;
+        }
+        for (uint32_t chunk = 0; chunk < chunks_.size(); ++chunk) {
+            const size_t count = ChunkSize(chunk);
+            std::destroy_n(chunks_[chunk], count);
+            NodeAllocatorTraits::deallocate(alloc_, chunks_[chunk], count);
+        }
+        chunks_.clear();
+        head_.next = kNone;
+        last_ = &head_;
+        free_ = kNone;
+        used_ = 0;
+        size_ = 0;
+    }
+
+private:
+    // Заполняет пустой список элементами [first, last), заранее
+    // выделив пул на reserve узлов. Используется конструкторами,
+    // поэтому при исключении сам освобождает уже созданное
+    template <typename InputIt>
+    void AssignNew(InputIt first, InputIt last, size_t reserve = 0) {
+        try {
+            Reserve(reserve);
+            InsertAfter(cbefore_begin(), first, last);
+        } catch (...) {
+            Clear();
+            throw;
+        }
+    }
+
+    // Обменивает всё, кроме аллокаторов. Последний узел пустого
+    // списка — его фиктивный узел, поэтому такие ссылки
+    // переставляются на фиктивный узел своего списка
+    void SwapContents(CompactSingleLinkedList& other) noexcept {
+        using std::swap;
+        chunks_.swap(other.chunks_);
+        swap(head_.next, other.head_.next);
+        swap(last_, other.last_);
+        if (last_ == &other.head_) {
+            last_ = &head_;
+        }
+        if (other.last_ == &head_) {
+            other.last_ = &other.head_;
+        }
+        swap(free_, other.free_);
+        swap(used_, other.used_);
+        swap(size_, other.size_);
+    }
+
+    // Кусок номер chunk содержит узлы с номерами
+    // [ChunkStart(chunk), ChunkStart(chunk + 1))
+    static constexpr size_t ChunkStart(uint32_t chunk) noexcept {
+        return ((size_t{1} << chunk) - 1) << kFirstChunkShift;
+    }
+
+    static constexpr size_t ChunkSize(uint32_t chunk) noexcept {
+        return size_t{1} << (chunk + kFirstChunkShift);
+    }
+
+    // Номер куска находится по старшему биту номера узла, сдвинутого
+    // на размер первого куска, без поиска по кускам
+    static Node& LocateNode(Node* const* chunks, uint32_t index) noexcept {
+        const uint64_t shifted = uint64_t{index} + (1u << kFirstChunkShift);
+        const uint32_t chunk =
+            static_cast<uint32_t>(std::bit_width(shifted)) - 1 -
+            kFirstChunkShift;
+        return chunks[chunk][shifted - ChunkSize(chunk)];
+    }
+
+    Node& NodeAt(uint32_t index) const noexcept {
+        return LocateNode(chunks_.data(), index);
+    }
+
+    Node* NextNode(const Node& node) const noexcept {
+        return node.next == kNone ? nullptr : &NodeAt(node.next);
+    }
+
+    Node* FirstNode() const noexcept {
+        return NextNode(head_);
+    }
+
+    // Итератор на фиктивный узел ссылается на список, остальные — на
+    // таблицу кусков
+    Iterator MakeIterator(Node* node) noexcept {
+        return node == &head_ ? Iterator{node, nullptr, this}
+                              : Iterator{node, chunks_.data()};
+    }
+
+    ConstIterator MakeIterator(const Node* node) const noexcept {
+        Node* mutable_node = const_cast<Node*>(node);
+        return node == &head_ ? ConstIterator{mutable_node, nullptr, this}
+                              : ConstIterator{mutable_node, chunks_.data()};
+    }
+
+    Node* FindNode(const Type& value) const {
+        Node* node = FirstNode();
+        while (node != nullptr && !(node->value == value)) {
+            node = NextNode(*node);
+        }
+        return node;
+    }
+
+    // Возвращает номер свободного узла. Сначала используются
+    // удалённые узлы, затем ещё не выданные, и только потом
+    // выделяется новый кусок
+    uint32_t TakeFreeIndex() {
+        if (free_ != kNone) {
+            const uint32_t index = free_;
+            free_ = NodeAt(index).next;
+            return index;
+        }
+        if (used_ == GetMaxSize()) {
+            throw std::length_error("CompactSingleLinkedList is full");
+        }
+        if (used_ == GetCapacity()) {
+            AllocateChunk();
+        }
+        return used_++;
+    }
+
+    void ReleaseIndex(uint32_t index) noexcept {
+        NodeAt(index).next = free_;
+        free_ = index;
+    }
+
+    // Добавляет кусок вдвое больше предыдущего. Таблица кусков
+    // сразу резервируется целиком, чтобы её адрес, на который
+    // ссылаются итераторы, не менялся
+    void AllocateChunk() {
+        if (chunks_.capacity() < kMaxChunks) {
+            chunks_.reserve(kMaxChunks);
+        }
+        const uint32_t chunk = static_cast<uint32_t>(chunks_.size());
+        const size_t count = ChunkSize(chunk);
+        Node* nodes = NodeAllocatorTraits::allocate(alloc_, count);
+        std::uninitialized_default_construct_n(nodes, count);
+        chunks_.push_back(nodes);
+    }
+
+    [[no_unique_address]] NodeAllocator alloc_;
+    std::vector<Node*> chunks_;
+    // Фиктивный узел перед первым элементом. Значение в нём не
+    // создаётся
+    Node head_{kNone};
+    // Последний узел списка либо head_ для пустого списка
+    Node* last_ = &head_;
+    // Начало списка свободных узлов, освобождённых EraseAfter
+    uint32_t free_ = kNone;
+    // Количество узлов, хотя бы раз выданных под элементы
+    uint32_t used_ = 0;
+    size_t size_ = 0;
+};
+
+template <typename Type, typename Allocator>
+void swap(CompactSingleLinkedList<Type, Allocator>& lhs,
+          CompactSingleLinkedList<Type, Allocator>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type, typename Allocator>
+bool operator==(const CompactSingleLinkedList<Type, Allocator>& lhs,
+                const CompactSingleLinkedList<Type, Allocator>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() &&
+           std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type, typename Allocator>
+bool operator!=(const CompactSingleLinkedList<Type, Allocator>& lhs,
+                const CompactSingleLinkedList<Type, Allocator>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, typename Allocator>
+bool operator<(const CompactSingleLinkedList<Type, Allocator>& lhs,
+               const CompactSingleLinkedList<Type, Allocator>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(),
+                                        rhs.begin(), rhs.end());
+}
+
+template <typename Type, typename Allocator>
+bool operator<=(const CompactSingleLinkedList<Type, Allocator>& lhs,
+                const CompactSingleLinkedList<Type, Allocator>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type, typename Allocator>
+bool operator>(const CompactSingleLinkedList<Type, Allocator>& lhs,
+               const CompactSingleLinkedList<Type, Allocator>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type, typename Allocator>
+bool operator>=(const CompactSingleLinkedList<Type, Allocator>& lhs,
+                const CompactSingleLinkedList<Type, Allocator>& rhs) {
+    return !(lhs < rhs);
+}
@@ -0,0 +1,397 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/*
+ * Домен указателей опасности (hazard pointers) для безопасного
+ * освобождения узлов lock-free структур.
+ * Поток, читающий узел, публикует его адрес в одной из своих ячеек.
+ * Снятый со структуры узел не удаляется сразу, а попадает в список
+ * отложенного удаления потока. Когда список вырастает, поток
+ * удаляет узлы, которые не опубликованы ни в одной ячейке.
+ * Число одновременно работающих с доменом потоков ограничено
+ * kMaxThreads
+ */
+class HazardPointerDomain {
+public:
+    static constexpr size_t kMaxThreads = 128;
+    static constexpr size_t kSlotsPerThread = 2;
+
+    // Возвращает единственный домен процесса
+    static HazardPointerDomain& Instance() {
+        static HazardPointerDomain domain;
+        return domain;
+    }
+
+    HazardPointerDomain(const HazardPointerDomain&) = delete;
+    HazardPointerDomain& operator=(const HazardPointerDomain&) = delete;
+
+    ~HazardPointerDomain() {
+        for (const Retired& retired : orphans_) {
+            retired.deleter(retired.ptr);
+        }
+    }
+
+    /*
+     * Публикует в ячейке slot текущего потока значение source и
+     * возвращает его. Значение перечитывается, пока публикация не
+     * совпадёт с содержимым source, поэтому возвращённый узел не
+     * будет удалён до вызова Clear
+     */
+    template <typename T>
+    T* Protect(size_t slot, const std::atomic<T*>& source) {
+        std::atomic<void*>& hazard = CurrentThread().Record(*this)
+                                         .hazards[slot];
+        T* ptr = source.load();
+        while (true) {
+            hazard.store(ptr);
+            T* current = source.load();
+            if (current == ptr) {
+                return ptr;
+            }
+            ptr = current;
+        }
+    }
+
+    // Снимает публикацию ячейки slot текущего потока
+    void Clear(size_t slot) noexcept {
+        CurrentThread().Record(*this).hazards[slot].store(nullptr);
+    }
+
+    // Откладывает удаление ptr до момента, когда он не будет
+    // опубликован ни одним потоком
+    template <typename T>
+    void Retire(T* ptr) {
+        ThreadState& state = CurrentThread();
+        state.retired.push_back(Retired{ptr, [](void* p) {
+                                             delete static_cast<T*>(p);
+                                         }});
+        if (state.retired.size() >= kScanThreshold) {
+            Scan(state.retired);
+        }
+    }
+
+private:
+    // Порог размера списка отложенного удаления, после которого
+    // поток освобождает неопубликованные узлы
+    static constexpr size_t kScanThreshold =
+        2 * kMaxThreads * kSlotsPerThread;
+
+    struct Retired {
+        void* ptr;
+        void (*deleter)(void*);
+    };
+
+    // Ячейки одного потока. Выравнивание исключает ложное
+    // разделение кэш-линий между потоками
+    struct alignas(64) HazardRecord {
+        std::atomic<bool> active{false};
+        std::atomic<void*> hazards[kSlotsPerThread] = {};
+    };
+
+    // Состояние потока: захваченная запись и отложенные узлы.
+    // При завершении потока запись освобождается, а неудалённые
+    // узлы передаются домену
+    struct ThreadState {
+        HazardRecord& Record(HazardPointerDomain& domain) {
+            if (record == nullptr) {
+                record = domain.AcquireRecord();
+            }
+            return *record;
+        }
+
+        ~ThreadState() {
+            if (record == nullptr) {
+                return;
+            }
+            HazardPointerDomain& domain = Instance();
+            for (auto& hazard : record->hazards) {
+                hazard.store(nullptr);
+            }
+            domain.Scan(retired);
+            {
+                std::lock_guard guard(domain.orphans_mutex_);
+                domain.orphans_.insert(domain.orphans_.end(),
+                                       retired.begin(), retired.end());
+            }
+            record->active.store(false);
+        }
+
+        HazardRecord* record = nullptr;
+        std::vector<Retired> retired;
+    };
+
+    HazardPointerDomain() = default;
+
+    static ThreadState& CurrentThread() {
+        thread_local ThreadState state;
+        return state;
+    }
+
+    HazardRecord* AcquireRecord() {
+        for (HazardRecord& record : records_) {
+            bool expected = false;
+            if (!record.active.load() &&
+                record.active.compare_exchange_strong(expected, true)) {
+                return &record;
+            }
+        }
+        assert(false && "too many threads use hazard pointers");
+        std::terminate();
+    }
+
+    // Удаляет из retired узлы, не опубликованные ни одним потоком
+    void Scan(std::vector<Retired>& retired) {
+        {
+            std::unique_lock guard(orphans_mutex_, std::try_to_lock);
+            if (guard.owns_lock() && !orphans_.empty()) {
+                retired.insert(retired.end(), orphans_.begin(),
+                               orphans_.end());
+                orphans_.clear();
+            }
+        }
+        std::vector<void*> hazards;
+        hazards.reserve(kMaxThreads * kSlotsPerThread);
+        for (const HazardRecord& record : records_) {
+            for (const auto& hazard : record.hazards) {
+                if (void* ptr = hazard.load()) {
+                    hazards.push_back(ptr);
+                }
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+        auto still_protected = std::partition(
+            retired.begin(), retired.end(), [&hazards](const Retired& r) {
+                return std::binary_search(hazards.begin(), hazards.end(),
+                                          r.ptr);
+            });
+        for (auto it = still_protected; it != retired.end(); ++it) {
+            it->deleter(it->ptr);
+        }
+        retired.erase(still_protected, retired.end());
+    }
+
+    HazardRecord records_[kMaxThreads];
+    std::mutex orphans_mutex_;
+    std::vector<Retired> orphans_;
+};
+
+// Режим работы ConcurrentSingleLinkedList
+enum class ConcurrentListMode {
+    // Стек Трайбера: PushFront и TryPopFront
+    kStack,
+    // Очередь Майкла — Скотта: PushBack и TryPopFront
+    kQueue,
+};
+
+/*
+ * Lock-free односвязный список для нескольких производителей и
+ * нескольких потребителей.
+ * Узлы устроены так же, как у SingleLinkedList (значение и
+ * указатель на следующий узел), но указатель атомарный.
+ * В режиме kStack элементы добавляются и извлекаются с начала
+ * списка, в режиме kQueue добавляются в конец и извлекаются с
+ * начала. Освобождение узлов выполняется через HazardPointerDomain.
+ * Конструктор и деструктор не должны выполняться параллельно с
+ * другими операциями
+ */
+template <typename Type,
+          ConcurrentListMode Mode = ConcurrentListMode::kQueue>
+class ConcurrentSingleLinkedList {
+    // Узел списка. Значение хранится в объединении, чтобы
+    // узел-заглушка очереди не требовал конструктора Type по
+    // умолчанию. Значение извлечённого узла разрушается до того,
+    // как узел передаётся на отложенное удаление
+    struct Node {
+        // Создаёт узел-заглушку без значения
+        Node() {
+        }
+
+        template <typename... Args>
+        explicit Node(std::in_place_t, Args&&... args)
+            : value(std::forward<Args>(args)...) {
+        }
+
+        ~Node() {
+        }
+
+        union {
+            Type value;
+        };
+        std::atomic<Node*> next_node = nullptr;
+    };
+
+public:
+    using value_type = Type;
+
+    ConcurrentSingleLinkedList() {
+        if constexpr (Mode == ConcurrentListMode::kQueue) {
+            Node* dummy = new Node();
+            head_.store(dummy);
+            tail_.store(dummy);
+        }
+    }
+
+    ConcurrentSingleLinkedList(const ConcurrentSingleLinkedList&) = delete;
+    ConcurrentSingleLinkedList& operator=(
+        const ConcurrentSingleLinkedList&) = delete;
+
+    // Разрушает оставшиеся элементы. Другие потоки не должны
+    // обращаться к списку
+    ~ConcurrentSingleLinkedList() {
+        Node* node = head_.load();
+        if constexpr (Mode == ConcurrentListMode::kQueue) {
+            Node* dummy = node;
+            node = dummy->next_node.load();
+            delete dummy;
+        }
+        while (node != nullptr) {
+            Node* next = node->next_node.load();
+            node->value.~Type();
+            delete node;
+            node = next;
+        }
+    }
+
+    // Атомарно вставляет элемент в начало списка (режим kStack)
+    template <typename... Args>
+    void EmplaceFront(Args&&... args) {
+        static_assert(Mode == ConcurrentListMode::kStack,
+                      "EmplaceFront requires ConcurrentListMode::kStack");
+        Node* node = new Node(std::in_place, std::forward<Args>(args)...);
+        Node* head = head_.load(std::memory_order_relaxed);
+        do {
+            node->next_node.store(head, std::memory_order_relaxed);
+        } while (!head_.compare_exchange_weak(head, node,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
+    }
+
+    void PushFront(const Type& value) {
+        EmplaceFront(value);
+    }
+
+    void PushFront(Type&& value) {
+        EmplaceFront(std::move(value));
+    }
+
+    // Атомарно вставляет элемент в конец списка (режим kQueue)
+    template <typename... Args>
+    void EmplaceBack(Args&&... args) {
+        static_assert(Mode == ConcurrentListMode::kQueue,
+                      "EmplaceBack requires ConcurrentListMode::kQueue");
+        Node* node = new Node(std::in_place, std::forward<Args>(args)...);
+        HazardPointerDomain& domain = HazardPointerDomain::Instance();
+        while (true) {
+            Node* tail = domain.Protect(0, tail_);
+            Node* next = tail->next_node.load();
+            if (tail != tail_.load()) {
+                continue;
+            }
+            if (next != nullptr) {
+                // Помогаем отстающему производителю сдвинуть хвост
+                tail_.compare_exchange_strong(tail, next);
+                continue;
+            }
+            if (tail->next_node.compare_exchange_weak(next, node)) {
+                tail_.compare_exchange_strong(tail, node);
+                break;
+            }
+        }
+        domain.Clear(0);
+    }
+
+    void PushBack(const Type& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(Type&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    // Атомарно извлекает первый элемент списка
+    // Возвращает std::nullopt, если список пуст
+    std::optional<Type> TryPopFront() {
+        if constexpr (Mode == ConcurrentListMode::kStack) {
+            return TryPopStack();
+        } else {
+            return TryPopQueue();
+        }
+    }
+
+    // Сообщает, был ли список пуст в момент проверки
+    [[nodiscard]] bool IsEmpty() const {
+        if constexpr (Mode == ConcurrentListMode::kStack) {
+            return head_.load() == nullptr;
+        } else {
+            HazardPointerDomain& domain = HazardPointerDomain::Instance();
+            Node* head = domain.Protect(0, head_);
+            const bool empty = head->next_node.load() == nullptr;
+            domain.Clear(0);
+            return empty;
+        }
+    }
+
+private:
+    std::optional<Type> TryPopStack() {
+        HazardPointerDomain& domain = HazardPointerDomain::Instance();
+        while (true) {
+            Node* head = domain.Protect(0, head_);
+            if (head == nullptr) {
+                domain.Clear(0);
+                return std::nullopt;
+            }
+            Node* next = head->next_node.load();
+            if (head_.compare_exchange_strong(head, next)) {
+                domain.Clear(0);
+                std::optional<Type> result(std::move(head->value));
+                head->value.~Type();
+                domain.Retire(head);
+                return result;
+            }
+        }
+    }
+
+    std::optional<Type> TryPopQueue() {
+        HazardPointerDomain& domain = HazardPointerDomain::Instance();
+        while (true) {
+            Node* head = domain.Protect(0, head_);
+            Node* tail = tail_.load();
+            Node* next = domain.Protect(1, head->next_node);
+            if (head != head_.load()) {
+                continue;
+            }
+            if (next == nullptr) {
+                domain.Clear(0);
+                domain.Clear(1);
+                return std::nullopt;
+            }
+            if (head == tail) {
+                tail_.compare_exchange_strong(tail, next);
+                continue;
+            }
+            if (head_.compare_exchange_strong(head, next)) {
+                // next стал заглушкой: его значение читает только
+                // поток, выигравший сдвиг головы
+                std::optional<Type> result(std::move(next->value));
+                next->value.~Type();
+                domain.Clear(0);
+                domain.Clear(1);
+                domain.Retire(head);
+                return result;
+            }
+        }
+    }
+
+    // Выравнивание разносит голову и хвост по разным кэш-линиям
+    alignas(64) std::atomic<Node*> head_ = nullptr;
+    alignas(64) std::atomic<Node*> tail_ = nullptr;
+};
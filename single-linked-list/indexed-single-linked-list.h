@@ -0,0 +1,381 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include "single-linked-list.h"
+
+/*
+ * Односвязный список пар ключ — значение с уникальными ключами и
+ * хеш-индексом. Элементы хранятся в SingleLinkedList в порядке
+ * вставки, а индекс сопоставляет ключу итератор на предыдущий узел.
+ * Поэтому поиск, удаление по ключу, вставка после элемента с ключом
+ * и перенос элемента в начало или конец выполняются за время O(1):
+ * предыдущий узел, нужный для EraseAfter и SpliceAfter, известен
+ * сразу. Индекс обновляется при любой вставке, удалении и переносе.
+ * Итераторы на элементы остаются действительными, пока элемент не
+ * удалён. Операции, меняющие список, принимают Iterator: его
+ * возвращают before_begin, before_end, Find и FindBefore
+ * неконстантного списка
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class IndexedSingleLinkedList {
+public:
+    using value_type = std::pair<const Key, Value>;
+    using List = SingleLinkedList<value_type>;
+    using Iterator = typename List::Iterator;
+    using ConstIterator = typename List::ConstIterator;
+
+    IndexedSingleLinkedList() = default;
+
+    // Создаёт список из пар values. Пары с повторяющимися ключами
+    // пропускаются
+    IndexedSingleLinkedList(std::initializer_list<value_type> values) {
+        for (const value_type& value : values) {
+            PushBack(value.first, value.second);
+        }
+    }
+
+    IndexedSingleLinkedList(const IndexedSingleLinkedList& other) {
+        index_.reserve(other.GetSize());
+        for (const value_type& value : other) {
+            PushBack(value.first, value.second);
+        }
+    }
+
+    // Узлы переходят вместе с индексом. Только первый элемент
+    // ссылается на фиктивный узел списка, поэтому правится его запись
+    IndexedSingleLinkedList(IndexedSingleLinkedList&& other) noexcept
+        : list_(std::move(other.list_))
+        , index_(std::move(other.index_)) {
+        other.index_.clear();
+        FixFrontEntry();
+    }
+
+    IndexedSingleLinkedList& operator=(const IndexedSingleLinkedList& rhs) {
+        if (this != &rhs) {
+            IndexedSingleLinkedList tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    IndexedSingleLinkedList& operator=(
+        IndexedSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            IndexedSingleLinkedList tmp(std::move(rhs));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    // Обменивает содержимое списков за время O(1)
+    void swap(IndexedSingleLinkedList& other) noexcept {
+        list_.swap(other.list_);
+        index_.swap(other.index_);
+        FixFrontEntry();
+        other.FixFrontEntry();
+    }
+
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return list_.before_begin();
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return list_.before_begin();
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return list_.cbefore_begin();
+    }
+
+    // Возвращает итератор на последний элемент либо before_begin()
+    [[nodiscard]] Iterator before_end() noexcept {
+        return list_.before_end();
+    }
+
+    [[nodiscard]] ConstIterator before_end() const noexcept {
+        return list_.before_end();
+    }
+
+    [[nodiscard]] Iterator begin() noexcept {
+        return list_.begin();
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return list_.end();
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return list_.begin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return list_.end();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return list_.cbegin();
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return list_.cend();
+    }
+
+    // Возвращает количество элементов за время O(1)
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return list_.GetSize();
+    }
+
+    // Сообщает, пустой ли список, за время O(1)
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return list_.IsEmpty();
+    }
+
+    // Возвращает итератор на элемент с ключом key либо end()
+    // за время O(1)
+    [[nodiscard]] Iterator Find(const Key& key) {
+        const auto entry = index_.find(key);
+        return entry != index_.end() ? std::next(entry->second) : end();
+    }
+
+    [[nodiscard]] ConstIterator Find(const Key& key) const {
+        const auto entry = index_.find(key);
+        return entry != index_.end() ? std::next(ConstIterator(entry->second))
+                                     : end();
+    }
+
+    // Возвращает итератор на элемент перед элементом с ключом key
+    // (before_begin() для первого) либо end(), если ключа нет
+    [[nodiscard]] Iterator FindBefore(const Key& key) {
+        const auto entry = index_.find(key);
+        return entry != index_.end() ? entry->second : end();
+    }
+
+    [[nodiscard]] ConstIterator FindBefore(const Key& key) const {
+        const auto entry = index_.find(key);
+        return entry != index_.end() ? ConstIterator(entry->second) : end();
+    }
+
+    // Сообщает, есть ли элемент с ключом key, за время O(1)
+    [[nodiscard]] bool Contains(const Key& key) const {
+        return index_.find(key) != index_.end();
+    }
+
+    /*
+     * Создаёт элемент с ключом key и значением из args после pos.
+     * Если ключ уже есть, список не меняется. Возвращает итератор на
+     * элемент с ключом key и признак того, что элемент вставлен.
+     * При исключении список и индекс остаются в прежнем состоянии
+     */
+    template <typename... Args>
+    std::pair<Iterator, bool> EmplaceAfter(Iterator pos, const Key& key,
+                                           Args&&... args) {
+        const auto [entry, inserted] = index_.try_emplace(key, pos);
+        if (!inserted) {
+            return {std::next(entry->second), false};
+        }
+        Iterator node;
+        try {
+            node = list_.EmplaceAfter(
+                pos, std::piecewise_construct, std::forward_as_tuple(key),
+                std::forward_as_tuple(std::forward<Args>(args)...));
+        } catch (...) {
+            index_.erase(entry);
+            throw;
+        }
+        SetPredecessorOfNext(node);
+        return {node, true};
+    }
+
+    std::pair<Iterator, bool> InsertAfter(Iterator pos, const Key& key,
+                                          const Value& value) {
+        return EmplaceAfter(pos, key, value);
+    }
+
+    std::pair<Iterator, bool> InsertAfter(Iterator pos, const Key& key,
+                                          Value&& value) {
+        return EmplaceAfter(pos, key, std::move(value));
+    }
+
+    // Вставляет элемент после элемента с ключом pos_key, который
+    // должен быть в списке, за время O(1)
+    template <typename... Args>
+    std::pair<Iterator, bool> EmplaceAfterKey(const Key& pos_key,
+                                              const Key& key,
+                                              Args&&... args) {
+        const Iterator pos = Find(pos_key);
+        assert(pos != end());
+        return EmplaceAfter(pos, key, std::forward<Args>(args)...);
+    }
+
+    std::pair<Iterator, bool> InsertAfterKey(const Key& pos_key,
+                                             const Key& key,
+                                             const Value& value) {
+        return EmplaceAfterKey(pos_key, key, value);
+    }
+
+    std::pair<Iterator, bool> InsertAfterKey(const Key& pos_key,
+                                             const Key& key, Value&& value) {
+        return EmplaceAfterKey(pos_key, key, std::move(value));
+    }
+
+    template <typename... Args>
+    std::pair<Iterator, bool> EmplaceFront(const Key& key, Args&&... args) {
+        return EmplaceAfter(before_begin(), key, std::forward<Args>(args)...);
+    }
+
+    std::pair<Iterator, bool> PushFront(const Key& key, const Value& value) {
+        return EmplaceFront(key, value);
+    }
+
+    std::pair<Iterator, bool> PushFront(const Key& key, Value&& value) {
+        return EmplaceFront(key, std::move(value));
+    }
+
+    template <typename... Args>
+    std::pair<Iterator, bool> EmplaceBack(const Key& key, Args&&... args) {
+        return EmplaceAfter(before_end(), key, std::forward<Args>(args)...);
+    }
+
+    std::pair<Iterator, bool> PushBack(const Key& key, const Value& value) {
+        return EmplaceBack(key, value);
+    }
+
+    std::pair<Iterator, bool> PushBack(const Key& key, Value&& value) {
+        return EmplaceBack(key, std::move(value));
+    }
+
+    /*
+     * Удаляет элемент, следующий за pos.
+     * Возвращает итератор на элемент, следующий за удалённым
+     */
+    Iterator EraseAfter(Iterator pos) noexcept {
+        assert(std::next(pos) != end());
+        index_.erase(std::next(pos)->first);
+        const Iterator next = list_.EraseAfter(pos);
+        SetPredecessorOfNext(pos);
+        return next;
+    }
+
+    // Удаляет элемент с ключом key за время O(1). Возвращает false,
+    // если такого ключа нет
+    bool EraseKey(const Key& key) noexcept {
+        const auto entry = index_.find(key);
+        if (entry == index_.end()) {
+            return false;
+        }
+        EraseAfter(entry->second);
+        return true;
+    }
+
+    void PopFront() noexcept {
+        assert(!IsEmpty());
+        EraseAfter(before_begin());
+    }
+
+    /*
+     * Переносит элемент с ключом key в позицию после pos за время
+     * O(1), перецепляя его узел. pos не может указывать на сам
+     * переносимый элемент. Возвращает итератор на элемент либо
+     * end(), если ключа нет
+     */
+    Iterator MoveAfter(Iterator pos, const Key& key) noexcept {
+        const auto entry = index_.find(key);
+        return entry != index_.end() ? MoveEntryAfter(pos, entry) : end();
+    }
+
+    // Переносит элемент с ключом key в начало списка за время O(1)
+    Iterator MoveToFront(const Key& key) noexcept {
+        return MoveAfter(before_begin(), key);
+    }
+
+    // Переносит элемент с ключом key в конец списка за время O(1)
+    Iterator MoveToBack(const Key& key) noexcept {
+        const auto entry = index_.find(key);
+        if (entry == index_.end()) {
+            return end();
+        }
+        const Iterator last = before_end();
+        const Iterator node = std::next(entry->second);
+        return node == last ? node : MoveEntryAfter(last, entry);
+    }
+
+    // Очищает список и индекс за время O(N)
+    void Clear() noexcept {
+        list_.Clear();
+        index_.clear();
+    }
+
+    // Резервирует место в индексе для count элементов
+    void Reserve(size_t count) {
+        index_.reserve(count);
+    }
+
+private:
+    using Index = std::unordered_map<Key, Iterator, Hash, KeyEqual>;
+
+    Iterator MoveEntryAfter(Iterator pos,
+                            typename Index::iterator entry) noexcept {
+        const Iterator prev = entry->second;
+        const Iterator node = std::next(prev);
+        assert(pos != node);
+        if (pos == prev) {
+            return node;
+        }
+        const Iterator next = std::next(node);
+        list_.SpliceAfter(pos, list_, prev, next);
+        if (next != end()) {
+            index_.find(next->first)->second = prev;
+        }
+        entry->second = pos;
+        SetPredecessorOfNext(node);
+        return node;
+    }
+
+    // Записывает node как предыдущий узел для элемента за ним
+    void SetPredecessorOfNext(Iterator node) noexcept {
+        const Iterator next = std::next(node);
+        if (next != end()) {
+            index_.find(next->first)->second = node;
+        }
+    }
+
+    void FixFrontEntry() noexcept {
+        if (!IsEmpty()) {
+            index_.find(begin()->first)->second = before_begin();
+        }
+    }
+
+    List list_;
+    // Ключ элемента -> итератор на предыдущий узел
+    Index index_;
+};
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void swap(IndexedSingleLinkedList<Key, Value, Hash, KeyEqual>& lhs,
+          IndexedSingleLinkedList<Key, Value, Hash, KeyEqual>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+// Списки равны, если совпадают их элементы в порядке обхода
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+bool operator==(const IndexedSingleLinkedList<Key, Value, Hash, KeyEqual>& lhs,
+                const IndexedSingleLinkedList<Key, Value, Hash, KeyEqual>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() &&
+           std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+bool operator!=(const IndexedSingleLinkedList<Key, Value, Hash, KeyEqual>& lhs,
+                const IndexedSingleLinkedList<Key, Value, Hash, KeyEqual>& rhs) {
+    return !(lhs == rhs);
+}
@@ -0,0 +1,277 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+// Связь элемента интрузивного списка. Объект, который нужно
+// помещать в IntrusiveSingleLinkedList, содержит поле этого типа
+struct IntrusiveListHook {
+    IntrusiveListHook* next = nullptr;
+};
+
+/*
+ * Интрузивный односвязный список: связывает объекты пользователя
+ * через их поле IntrusiveListHook, заданное указателем на член Hook.
+ * Список не владеет объектами, не копирует их и не выделяет память:
+ * вставка и удаление только перецепляют связи. Объект должен жить
+ * дольше, чем находится в списке, и одновременно может состоять
+ * только в одном списке через одно поле связи.
+ * Интерфейс повторяет SingleLinkedList: before_begin, InsertAfter,
+ * EraseAfter, PopFront и однонаправленные итераторы. Удаление
+ * элемента из списка не разрушает объект
+ */
+template <typename T, IntrusiveListHook T::*Hook>
+class IntrusiveSingleLinkedList {
+    // Шаблон класса «Базовый Итератор».
+    // Итератор хранит связь элемента, а объект находит по смещению
+    // поля связи
+    // ValueType — совпадает с T (для Iterator) либо с
+    // const T (для ConstIterator)
+    template <typename ValueType>
+    class BasicIterator {
+        friend class IntrusiveSingleLinkedList;
+
+        explicit BasicIterator(IntrusiveListHook* hook) noexcept
+            : hook_(hook) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        // Конвертирующий конструктор/конструктор копирования
+        BasicIterator(const BasicIterator<T>& other) noexcept
+            : hook_(other.hook_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        [[nodiscard]] bool operator==
+            (const BasicIterator<const T>& rhs) const noexcept {
+            return hook_ == rhs.hook_;
+        }
+
+        [[nodiscard]] bool operator!=
+            (const BasicIterator<const T>& rhs) const noexcept {
+            return hook_ != rhs.hook_;
+        }
+
+        [[nodiscard]] bool operator==
+            (const BasicIterator<T>& rhs) const noexcept {
+            return hook_ == rhs.hook_;
+        }
+
+        [[nodiscard]] bool operator!=
+            (const BasicIterator<T>& rhs) const noexcept {
+            return hook_ != rhs.hook_;
+        }
+
+        BasicIterator& operator++() noexcept {
+            assert(hook_ != nullptr);
+            hook_ = hook_->next;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto old_value(*this);
+            ++(*this);
+            return old_value;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(hook_ != nullptr);
+            return *OwnerOf(hook_);
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            return &**this;
+        }
+
+    private:
+        IntrusiveListHook* hook_ = nullptr;
+    };
+
+public:
+    using value_type = T;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<T>;
+    using ConstIterator = BasicIterator<const T>;
+
+    IntrusiveSingleLinkedList() = default;
+
+    // Копирование запрещено: объект не может состоять в двух списках
+    IntrusiveSingleLinkedList(const IntrusiveSingleLinkedList&) = delete;
+    IntrusiveSingleLinkedList& operator=(const IntrusiveSingleLinkedList&) =
+        delete;
+
+    // Перемещение забирает связанные объекты за время O(1)
+    IntrusiveSingleLinkedList(IntrusiveSingleLinkedList&& other) noexcept {
+        swap(other);
+    }
+
+    IntrusiveSingleLinkedList& operator=(
+        IntrusiveSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            Clear();
+            swap(rhs);
+        }
+        return *this;
+    }
+
+    // Отцепляет объекты, не разрушая их
+    ~IntrusiveSingleLinkedList() {
+        Clear();
+    }
+
+    // Обменивает содержимое списков за время O(1)
+    void swap(IntrusiveSingleLinkedList& other) noexcept {
+        std::swap(head_.next, other.head_.next);
+        std::swap(size_, other.size_);
+        std::swap(last_hook_, other.last_hook_);
+    }
+
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return Iterator{&head_};
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator{const_cast<IntrusiveListHook*>(&head_)};
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    [[nodiscard]] Iterator begin() noexcept {
+        return Iterator{head_.next};
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator{nullptr};
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator{head_.next};
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator{nullptr};
+    }
+
+    // Возвращает количество элементов в списке за время O(1)
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Сообщает, пустой ли список за время O(1)
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Вставляет объект value в начало списка за время O(1)
+    void PushFront(T& value) noexcept {
+        InsertAfter(cbefore_begin(), value);
+    }
+
+    // Вставляет объект value в конец списка за время O(1)
+    void PushBack(T& value) noexcept {
+        InsertAfter(last_hook_ != nullptr ? ConstIterator{last_hook_}
+                                          : cbefore_begin(),
+                    value);
+    }
+
+    /*
+     * Вставляет объект value после элемента, на который указывает
+     * pos, за время O(1).
+     * Возвращает итератор на вставленный элемент
+     */
+    Iterator InsertAfter(ConstIterator pos, T& value) noexcept {
+        assert(pos.hook_ != nullptr);
+        IntrusiveListHook* hook = &(value.*Hook);
+        hook->next = pos.hook_->next;
+        pos.hook_->next = hook;
+        if (hook->next == nullptr) {
+            last_hook_ = hook;
+        }
+        ++size_;
+        return Iterator{hook};
+    }
+
+    // Отцепляет первый элемент списка, не разрушая его
+    void PopFront() noexcept {
+        assert(!IsEmpty());
+        EraseAfter(cbefore_begin());
+    }
+
+    /*
+     * Отцепляет элемент, следующий за pos, не разрушая его.
+     * Возвращает итератор на элемент, следующий за удалённым
+     */
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        assert(pos.hook_ != nullptr && pos.hook_->next != nullptr);
+        IntrusiveListHook* erased = pos.hook_->next;
+        pos.hook_->next = std::exchange(erased->next, nullptr);
+        if (pos.hook_->next == nullptr) {
+            last_hook_ = pos.hook_ == &head_ ? nullptr : pos.hook_;
+        }
+        --size_;
+        return Iterator{pos.hook_->next};
+    }
+
+    // Отцепляет все элементы за время O(N). Поля связи объектов
+    // сбрасываются
+    void Clear() noexcept {
+        while (head_.next != nullptr) {
+            head_.next = std::exchange(head_.next->next, nullptr);
+        }
+        size_ = 0;
+        last_hook_ = nullptr;
+    }
+
+private:
+    // Возвращает объект, которому принадлежит поле связи hook
+    static T* OwnerOf(IntrusiveListHook* hook) noexcept {
+        return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) -
+                                    HookOffset());
+    }
+
+    // Смещение поля связи от начала объекта. Берётся адрес поля в
+    // хранилище размера T: объект в нём не создаётся, поэтому не
+    // нужен конструктор T и не используется представление указателя
+    // на член, которое зависит от ABI. Компилятор сворачивает
+    // вычисление в константу
+    static std::ptrdiff_t HookOffset() noexcept {
+        alignas(T) std::byte storage[sizeof(T)];
+        T* object = reinterpret_cast<T*>(storage);
+        return reinterpret_cast<char*>(&(object->*Hook)) -
+               reinterpret_cast<char*>(object);
+    }
+
+    // Фиктивная связь перед первым элементом
+    IntrusiveListHook head_;
+    size_t size_ = 0;
+    IntrusiveListHook* last_hook_ = nullptr;
+};
+
+template <typename T, IntrusiveListHook T::*Hook>
+void swap(IntrusiveSingleLinkedList<T, Hook>& lhs,
+          IntrusiveSingleLinkedList<T, Hook>& rhs) noexcept {
+    lhs.swap(rhs);
+}
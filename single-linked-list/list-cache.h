@@ -0,0 +1,246 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+#include "indexed-single-linked-list.h"
+
+// Порядок вытеснения ListCache
+enum class CacheEvictionPolicy {
+    // Вытесняется запись, к которой дольше всего не обращались
+    kLru,
+    // Вытесняется запись, добавленная раньше всех
+    kFifo,
+};
+
+// Счётчики обращений к кэшу
+struct CacheStats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+};
+
+// Оценка размера записи по умолчанию: размер ключа и значения без
+// памяти, которой они владеют
+struct DefaultCacheWeigher {
+    template <typename Key, typename Value>
+    size_t operator()(const Key&, const Value&) const noexcept {
+        return sizeof(Key) + sizeof(Value);
+    }
+};
+
+/*
+ * Кэш ключ — значение с ограничением по числу записей и по
+ * суммарному размеру. Записи хранятся в IndexedSingleLinkedList от
+ * старой к новой, поэтому Get, Put, Touch и вытеснение самой старой
+ * записи выполняются за время O(1): запись находится по индексу, а
+ * обновлённая запись переносится в конец перецеплением узла.
+ * Размер записи определяет Weigher при Put. При вытеснении
+ * вызывается обработчик, заданный SetEvictionCallback, которому
+ * передаётся ключ и значение записи. Erase и Clear обработчик не
+ * вызывают
+ */
+template <typename Key, typename Value, CacheEvictionPolicy Policy,
+          typename Hash = std::hash<Key>,
+          typename Weigher = DefaultCacheWeigher>
+class ListCache {
+    struct Entry {
+        Entry() = default;
+
+        template <typename... Args>
+        explicit Entry(size_t entry_bytes, Args&&... args)
+            : value(std::forward<Args>(args)...)
+            , bytes(entry_bytes) {
+        }
+
+        Value value;
+        size_t bytes = 0;
+    };
+
+    using Entries = IndexedSingleLinkedList<Key, Entry, Hash>;
+
+public:
+    using EvictionCallback = std::function<void(const Key&, Value&&)>;
+
+    // Ограничение, которое не действует
+    static constexpr size_t kUnlimited = std::numeric_limits<size_t>::max();
+
+    explicit ListCache(size_t max_entries, size_t max_bytes = kUnlimited,
+                       Weigher weigher = Weigher())
+        : max_entries_(max_entries)
+        , max_bytes_(max_bytes)
+        , weigher_(std::move(weigher)) {
+        assert(max_entries > 0);
+    }
+
+    // Задаёт обработчик вытесненных записей
+    void SetEvictionCallback(EvictionCallback callback) {
+        on_evict_ = std::move(callback);
+    }
+
+    /*
+     * Возвращает указатель на значение по ключу key либо nullptr и
+     * учитывает попадание или промах. В режиме kLru запись становится
+     * самой новой. Указатель действителен, пока запись в кэше
+     */
+    [[nodiscard]] Value* Get(const Key& key) {
+        const auto it = Access(key);
+        if (it == entries_.end()) {
+            ++stats_.misses;
+            return nullptr;
+        }
+        ++stats_.hits;
+        return &it->second.value;
+    }
+
+    // Возвращает значение по ключу key, не меняя порядок вытеснения
+    // и счётчики
+    [[nodiscard]] const Value* Peek(const Key& key) const {
+        const auto it = entries_.Find(key);
+        return it != entries_.end() ? &it->second.value : nullptr;
+    }
+
+    [[nodiscard]] bool Contains(const Key& key) const {
+        return entries_.Contains(key);
+    }
+
+    // Делает запись с ключом key самой новой в любом режиме.
+    // Возвращает false, если ключа нет
+    bool Touch(const Key& key) {
+        return entries_.MoveToBack(key) != entries_.end();
+    }
+
+    /*
+     * Записывает значение value по ключу key. Новая запись
+     * добавляется как самая новая. Существующая запись обновляется и
+     * в режиме kLru становится самой новой, а в режиме kFifo
+     * сохраняет своё место. Затем самые старые записи вытесняются,
+     * пока кэш не уложится в ограничения; вытеснена может быть и
+     * записанная, если она одна больше ограничения по размеру.
+     * Возвращает true, если запись добавлена
+     */
+    bool Put(const Key& key, Value value) {
+        const size_t entry_bytes = weigher_(key, value);
+        const auto it = Access(key);
+        const bool inserted = it == entries_.end();
+        if (inserted) {
+            entries_.EmplaceBack(key, entry_bytes, std::move(value));
+        } else {
+            it->second.value = std::move(value);
+            bytes_ -= it->second.bytes;
+            it->second.bytes = entry_bytes;
+        }
+        bytes_ += entry_bytes;
+        EvictOverBudget();
+        return inserted;
+    }
+
+    // Удаляет запись с ключом key без вызова обработчика вытеснения
+    bool Erase(const Key& key) {
+        const auto prev = entries_.FindBefore(key);
+        if (prev == entries_.end()) {
+            return false;
+        }
+        bytes_ -= std::next(prev)->second.bytes;
+        entries_.EraseAfter(prev);
+        return true;
+    }
+
+    // Вытесняет самую старую запись. Возвращает false, если кэш пуст
+    bool EvictOldest() {
+        if (entries_.IsEmpty()) {
+            return false;
+        }
+        auto& [key, entry] = *entries_.begin();
+        if (on_evict_) {
+            on_evict_(key, std::move(entry.value));
+        }
+        bytes_ -= entry.bytes;
+        entries_.PopFront();
+        ++stats_.evictions;
+        return true;
+    }
+
+    // Удаляет все записи без вызова обработчика вытеснения
+    void Clear() noexcept {
+        entries_.Clear();
+        bytes_ = 0;
+    }
+
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return entries_.GetSize();
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return entries_.IsEmpty();
+    }
+
+    // Возвращает суммарный размер записей по оценке Weigher
+    [[nodiscard]] size_t GetBytes() const noexcept {
+        return bytes_;
+    }
+
+    [[nodiscard]] size_t GetMaxEntries() const noexcept {
+        return max_entries_;
+    }
+
+    [[nodiscard]] size_t GetMaxBytes() const noexcept {
+        return max_bytes_;
+    }
+
+    [[nodiscard]] const CacheStats& GetStats() const noexcept {
+        return stats_;
+    }
+
+    void ResetStats() noexcept {
+        stats_ = CacheStats();
+    }
+
+    // Вызывает func(key, value) для записей от самой старой к самой
+    // новой
+    template <typename Func>
+    void ForEach(Func func) const {
+        for (const auto& [key, entry] : entries_) {
+            func(key, entry.value);
+        }
+    }
+
+private:
+    // Находит запись при обращении. В режиме kLru она становится
+    // самой новой
+    typename Entries::Iterator Access(const Key& key) {
+        if constexpr (Policy == CacheEvictionPolicy::kLru) {
+            return entries_.MoveToBack(key);
+        } else {
+            return entries_.Find(key);
+        }
+    }
+
+    void EvictOverBudget() {
+        while (GetSize() > max_entries_ || bytes_ > max_bytes_) {
+            EvictOldest();
+        }
+    }
+
+    Entries entries_;
+    size_t max_entries_;
+    size_t max_bytes_;
+    size_t bytes_ = 0;
+    [[no_unique_address]] Weigher weigher_;
+    EvictionCallback on_evict_;
+    CacheStats stats_;
+};
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Weigher = DefaultCacheWeigher>
+using LruCache =
+    ListCache<Key, Value, CacheEvictionPolicy::kLru, Hash, Weigher>;
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Weigher = DefaultCacheWeigher>
+using FifoCache =
+    ListCache<Key, Value, CacheEvictionPolicy::kFifo, Hash, Weigher>;
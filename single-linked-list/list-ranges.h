@@ -0,0 +1,53 @@
+#pragma once
+
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "single-linked-list.h"
+
+/*
+ * Завершение ленивой цепочки std::views, собирающее её элементы в
+ * контейнер:
+ *
+ *     auto result = lst
+ *                   | std::views::filter(is_even)
+ *                   | std::views::transform(square)
+ *                   | std::views::take(10)
+ *                   | To<SingleLinkedList>();
+ *
+ * Адаптеры std::views ничего не вычисляют и не выделяют, пока
+ * цепочку не начнут обходить. To обходит её один раз: для
+ * SingleLinkedList узлы создаются и связываются одной цепочкой через
+ * конструктор с тегом kFromRange, другие контейнеры заполняются
+ * вызовами PushBack
+ */
+template <template <typename...> class Container>
+class ToContainer {
+public:
+    template <std::ranges::input_range Range>
+    [[nodiscard]] constexpr auto operator()(Range&& range) const {
+        using Result = Container<std::ranges::range_value_t<Range>>;
+        if constexpr (std::is_constructible_v<Result, FromRange, Range>) {
+            return Result(kFromRange, std::forward<Range>(range));
+        } else {
+            Result result;
+            for (auto&& value : range) {
+                result.PushBack(std::forward<decltype(value)>(value));
+            }
+            return result;
+        }
+    }
+
+    template <std::ranges::input_range Range>
+    [[nodiscard]] friend constexpr auto operator|(Range&& range,
+                                                  const ToContainer& to) {
+        return to(std::forward<Range>(range));
+    }
+};
+
+// Возвращает завершение цепочки, собирающее элементы в Container
+template <template <typename...> class Container>
+[[nodiscard]] constexpr ToContainer<Container> To() noexcept {
+    return {};
+}
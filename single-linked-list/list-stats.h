@@ -0,0 +1,349 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <utility>
+
+// Снимок счётчиков одного списка
+struct ListStats {
+    // Узлы, полученные у аллокатора и возвращённые ему
+    uint64_t node_allocations = 0;
+    uint64_t node_deallocations = 0;
+    // Вставки и удаления с концов списка
+    uint64_t push_front = 0;
+    uint64_t push_back = 0;
+    uint64_t pop_front = 0;
+    // Вызовы InsertAfter/EmplaceAfter и EraseAfter
+    uint64_t insert_after = 0;
+    uint64_t erase_after = 0;
+    // Наибольший размер списка за время жизни
+    uint64_t max_size = 0;
+    // Начатые обходы (вызовы begin/cbegin) и выполненные шаги
+    // итераторов, полученных от begin/cbegin
+    uint64_t traversals = 0;
+    uint64_t traversal_steps = 0;
+
+    ListStats& operator+=(const ListStats& rhs) noexcept {
+        node_allocations += rhs.node_allocations;
+        node_deallocations += rhs.node_deallocations;
+        push_front += rhs.push_front;
+        push_back += rhs.push_back;
+        pop_front += rhs.pop_front;
+        insert_after += rhs.insert_after;
+        erase_after += rhs.erase_after;
+        max_size = std::max(max_size, rhs.max_size);
+        traversals += rhs.traversals;
+        traversal_steps += rhs.traversal_steps;
+        return *this;
+    }
+};
+
+/*
+ * Политика статистики по умолчанию: ничего не считает.
+ * Все методы пустые, объект не занимает места в списке, поэтому
+ * SingleLinkedList с этой политикой не платит за инструментирование
+ */
+struct NoListStats {
+    static constexpr bool kEnabled = false;
+
+    constexpr void OnNodeAllocate() noexcept {
+    }
+    constexpr void OnNodeDeallocate() noexcept {
+    }
+    constexpr void OnPushFront() noexcept {
+    }
+    constexpr void OnPushBack() noexcept {
+    }
+    constexpr void OnPopFront() noexcept {
+    }
+    constexpr void OnInsertAfter() noexcept {
+    }
+    constexpr void OnEraseAfter() noexcept {
+    }
+    constexpr void OnSize(size_t) noexcept {
+    }
+    constexpr void OnTraversal() noexcept {
+    }
+    constexpr void OnTraversalStep() noexcept {
+    }
+
+    [[nodiscard]] constexpr ListStats GetStats() const noexcept {
+        return {};
+    }
+};
+
+class CountingListStats;
+
+/*
+ * Счётчик шагов итераторов одного списка. Лежит в статистике
+ * списка, которая не переносится при обмене и перемещении, поэтому
+ * итератор ссылается на него простым указателем: шаги итератора
+ * засчитываются списку, от которого он получен, даже после передачи
+ * узлов другому списку. Копирование итератора не трогает счётчиков
+ * ссылок
+ */
+class TraversalStepCounter {
+public:
+    // Счётчик пишет один поток, поэтому достаточно неатомарного
+    // чтения-изменения-записи без блокировки шины
+    void Increment() noexcept {
+        steps_.store(steps_.load(std::memory_order_relaxed) + 1,
+                     std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t Load() const noexcept {
+        return steps_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> steps_ = 0;
+};
+
+/*
+ * Реестр всех живых списков с CountingListStats.
+ * Позволяет получить снимок счётчиков и выгрузить его в JSON.
+ * Счётчики уничтоженных списков суммируются по имени, чтобы
+ * короткоживущие списки не пропадали из отчёта.
+ * Снимок можно снимать из любого потока
+ */
+class ListStatsRegistry {
+public:
+    static ListStatsRegistry& Instance() {
+        static ListStatsRegistry registry;
+        return registry;
+    }
+
+    ListStatsRegistry(const ListStatsRegistry&) = delete;
+    ListStatsRegistry& operator=(const ListStatsRegistry&) = delete;
+
+    // Возвращает суммарные счётчики по именам списков: живых и уже
+    // уничтоженных
+    [[nodiscard]] std::map<std::string, ListStats> Snapshot() const;
+
+    // Записывает снимок в out в формате JSON
+    void WriteJson(std::ostream& out) const;
+
+private:
+    friend class CountingListStats;
+
+    ListStatsRegistry() = default;
+
+    void Register(const CountingListStats* stats) {
+        std::lock_guard guard(mutex_);
+        live_.insert(stats);
+    }
+
+    void Unregister(const CountingListStats* stats,
+                    const std::string& name, const ListStats& final_stats) {
+        std::lock_guard guard(mutex_);
+        live_.erase(stats);
+        retired_[name] += final_stats;
+    }
+
+    mutable std::mutex mutex_;
+    std::set<const CountingListStats*> live_;
+    std::map<std::string, ListStats> retired_;
+};
+
+/*
+ * Политика статистики, считающая события списка.
+ * Счётчики изменяются только владеющим списком, но читаются
+ * атомарно, поэтому реестр может снимать их из другого потока.
+ * Имя задаётся через SetName и служит ключом в отчёте реестра
+ */
+class CountingListStats {
+    friend class ListStatsRegistry;
+
+public:
+    static constexpr bool kEnabled = true;
+
+    CountingListStats() {
+        ListStatsRegistry::Instance().Register(this);
+    }
+
+    // Копия списка получает собственные счётчики с тем же именем
+    CountingListStats(const CountingListStats& other)
+        : name_(other.GetName()) {
+        ListStatsRegistry::Instance().Register(this);
+    }
+
+    CountingListStats& operator=(const CountingListStats&) = delete;
+
+    ~CountingListStats() {
+        ListStatsRegistry::Instance().Unregister(this, GetName(), GetStats());
+    }
+
+    void SetName(std::string name) {
+        std::lock_guard guard(ListStatsRegistry::Instance().mutex_);
+        name_ = std::move(name);
+    }
+
+    [[nodiscard]] std::string GetName() const {
+        std::lock_guard guard(ListStatsRegistry::Instance().mutex_);
+        return name_;
+    }
+
+    void OnNodeAllocate() noexcept {
+        Increment(node_allocations_);
+    }
+    void OnNodeDeallocate() noexcept {
+        Increment(node_deallocations_);
+    }
+    void OnPushFront() noexcept {
+        Increment(push_front_);
+    }
+    void OnPushBack() noexcept {
+        Increment(push_back_);
+    }
+    void OnPopFront() noexcept {
+        Increment(pop_front_);
+    }
+    void OnInsertAfter() noexcept {
+        Increment(insert_after_);
+    }
+    void OnEraseAfter() noexcept {
+        Increment(erase_after_);
+    }
+    void OnSize(size_t size) noexcept {
+        if (size > max_size_.load(std::memory_order_relaxed)) {
+            max_size_.store(size, std::memory_order_relaxed);
+        }
+    }
+    void OnTraversal() noexcept {
+        Increment(traversals_);
+    }
+    void OnTraversalStep() noexcept {
+        traversal_steps_.Increment();
+    }
+
+    // Возвращает счётчик шагов, на который ссылаются итераторы списка
+    [[nodiscard]] TraversalStepCounter* GetTraversalStepCounter() noexcept {
+        return &traversal_steps_;
+    }
+
+    [[nodiscard]] ListStats GetStats() const noexcept {
+        ListStats stats;
+        stats.node_allocations = Load(node_allocations_);
+        stats.node_deallocations = Load(node_deallocations_);
+        stats.push_front = Load(push_front_);
+        stats.push_back = Load(push_back_);
+        stats.pop_front = Load(pop_front_);
+        stats.insert_after = Load(insert_after_);
+        stats.erase_after = Load(erase_after_);
+        stats.max_size = Load(max_size_);
+        stats.traversals = Load(traversals_);
+        stats.traversal_steps = traversal_steps_.Load();
+        return stats;
+    }
+
+private:
+    using Counter = std::atomic<uint64_t>;
+
+    // Счётчик пишет единственный поток, поэтому достаточно
+    // неатомарного чтения-изменения-записи без блокировки шины
+    static void Increment(Counter& counter) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+    }
+
+    static uint64_t Load(const Counter& counter) noexcept {
+        return counter.load(std::memory_order_relaxed);
+    }
+
+    std::string name_ = "unnamed";
+    Counter node_allocations_ = 0;
+    Counter node_deallocations_ = 0;
+    Counter push_front_ = 0;
+    Counter push_back_ = 0;
+    Counter pop_front_ = 0;
+    Counter insert_after_ = 0;
+    Counter erase_after_ = 0;
+    Counter max_size_ = 0;
+    Counter traversals_ = 0;
+    TraversalStepCounter traversal_steps_;
+};
+
+inline std::map<std::string, ListStats> ListStatsRegistry::Snapshot() const {
+    std::lock_guard guard(mutex_);
+    std::map<std::string, ListStats> result = retired_;
+    for (const CountingListStats* stats : live_) {
+        // Имя читается без повторного захвата мьютекса реестра
+        result[stats->name_] += stats->GetStats();
+    }
+    return result;
+}
+
+inline void ListStatsRegistry::WriteJson(std::ostream& out) const {
+    const auto snapshot = Snapshot();
+    out << "{\"lists\": [";
+    bool first = true;
+    for (const auto& [name, stats] : snapshot) {
+        out << (first ? "" : ", ") << "{\"name\": \"";
+        for (const char c : name) {
+            if (c == '"' || c == '\\') {
+                out << '\\';
+            }
+            out << c;
+        }
+        out << "\", \"node_allocations\": " << stats.node_allocations
+            << ", \"node_deallocations\": " << stats.node_deallocations
+            << ", \"push_front\": " << stats.push_front
+            << ", \"push_back\": " << stats.push_back
+            << ", \"pop_front\": " << stats.pop_front
+            << ", \"insert_after\": " << stats.insert_after
+            << ", \"erase_after\": " << stats.erase_after
+            << ", \"max_size\": " << stats.max_size
+            << ", \"traversals\": " << stats.traversals
+            << ", \"traversal_steps\": " << stats.traversal_steps << '}';
+        first = false;
+    }
+    out << "]}";
+}
+
+/*
+ * Счётчик шагов итератора списка со статистикой StatsPolicy.
+ * Итератор наследуется от него: при выключенной статистике база
+ * пуста и не увеличивает размер итератора, при включённой хранит
+ * указатель на счётчик шагов статистики списка (см.
+ * TraversalStepCounter). Такой итератор остаётся действительным
+ * после перемещения и обмена, но не после разрушения списка, от
+ * которого получен. Итераторы, полученные не от begin/cbegin,
+ * счётчика не имеют и шаги не считают
+ */
+template <typename StatsPolicy, bool kEnabled = StatsPolicy::kEnabled>
+class ListTraversalCounter {
+protected:
+    ListTraversalCounter() = default;
+
+    constexpr explicit ListTraversalCounter(StatsPolicy*) noexcept {
+    }
+
+    constexpr void CountStep() const noexcept {
+    }
+};
+
+template <typename StatsPolicy>
+class ListTraversalCounter<StatsPolicy, true> {
+protected:
+    ListTraversalCounter() = default;
+
+    explicit ListTraversalCounter(StatsPolicy* stats) noexcept
+        : steps_(stats->GetTraversalStepCounter()) {
+    }
+
+    void CountStep() const noexcept {
+        if (steps_ != nullptr) {
+            steps_->Increment();
+        }
+    }
+
+private:
+    TraversalStepCounter* steps_ = nullptr;
+};
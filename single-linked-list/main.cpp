@@ -1,464 +1,48 @@
+#include <algorithm>
+#include <atomic>
 #include <cassert>
-
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <set>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "channel-list.h"
+#include "compact-single-linked-list.h"
+#include "concurrent-single-linked-list.h"
+#include "indexed-single-linked-list.h"
+#include "intrusive-single-linked-list.h"
+#include "list-cache.h"
+#include "list-ranges.h"
+#include "list-stats.h"
+#include "mapped-single-linked-list.h"
+#include "node-pool.h"
+#include "parallel-list-algorithms.h"
+#include "persistent-single-linked-list.h"
+#include "simd-kernels.h"
 #include "single-linked-list.h"
+#include "small-single-linked-list.h"
+#include "sorted-single-linked-list.h"
+#include "static-single-linked-list.h"
+#include "unrolled-single-linked-list.h"
 
 using namespace std;
 
-template <typename Type>
-class SingleLinkedList {
-    // Узел списка
-    struct Node {
-        Node() = default;
-        Node(const Type& val, Node* next)
-            : value(val)
-            , next_node(next) {
-        }
-        Type value;
-        Node* next_node = nullptr;
-    };
-
-    // Шаблон класса «Базовый Итератор».
-    // Определяет поведение итератора на элементы односвязного
-    // списка
-    // ValueType — совпадает с Type (для Iterator) либо с
-    // const Type (для ConstIterator)
-    template <typename ValueType>
-    class BasicIterator {
-        // Класс списка объявляется дружественным, чтобы из методов
-        // списка был доступ к приватной области итератора
-        friend class SingleLinkedList;
-
-        // Конвертирующий конструктор итератора из указателя на
-        // узел списка
-        explicit BasicIterator(Node* node) {
-            node_ = node;
-        }
-
-    public:
-        // Объявленные ниже типы сообщают стандартной библиотеке о
-        // свойствах этого итератора
-
-        // Категория итератора — forward iterator
-        // (итератор, который поддерживает операции инкремента и
-        // многократное разыменование)
-        using iterator_category = std::forward_iterator_tag;
-        // Тип элементов, по которым перемещается итератор
-        using value_type = Type;
-        // Тип, используемый для хранения смещения между итераторами
-        using difference_type = std::ptrdiff_t;
-        // Тип указателя на итерируемое значение
-        using pointer = ValueType*;
-        // Тип ссылки на итерируемое значение
-        using reference = ValueType&;
-
-        BasicIterator() = default;
-
-        // Конвертирующий конструктор/конструктор копирования
-        // При ValueType, совпадающем с Type, играет роль
-        // копирующего конструктора
-        // При ValueType, совпадающем с const Type, играет роль
-        // конвертирующего конструктора
-        BasicIterator(const BasicIterator<Type>& other) noexcept {
-            node_ = other.node_;
-        }
-
-        // Чтобы компилятор не выдавал предупреждение об отсутствии
-        // оператора = при наличии пользовательского конструктора
-        // копирования, явно объявим оператор = и попросим
-        // компилятор сгенерировать его за нас
-        BasicIterator& operator=(const BasicIterator& rhs) =
-                                 default;
-
-        // Оператор сравнения итераторов (в роли второго аргумента
-        // выступает константный итератор)
-        // Два итератора равны, если они ссылаются на один и тот же
-        // элемент списка либо на end()
-        [[nodiscard]] bool operator==
-            (const BasicIterator<const Type>& rhs) const noexcept {
-            return node_ == rhs.node_;
-            
-        }
-
-        // Оператор проверки итераторов на неравенство
-        // Противоположен !=
-        [[nodiscard]] bool operator!=
-            (const BasicIterator<const Type>& rhs) const noexcept {
-            return node_ != rhs.node_;
-        }
-
-        // Оператор сравнения итераторов (в роли второго аргумента
-        // итератор)
-        // Два итератора равны, если они ссылаются на один и тот же
-        // элемент списка либо на end()
-        [[nodiscard]] bool operator==
-            (const BasicIterator<Type>& rhs) const noexcept {
-            return node_ == rhs.node_;
-        }
-
-        // Оператор проверки итераторов на неравенство
-        // Противоположен !=
-        [[nodiscard]] bool operator!=
-            (const BasicIterator<Type>& rhs) const noexcept {
-            return node_ != rhs.node_;
-        }
-
-        // Оператор прединкремента. После его вызова итератор
-        // указывает на следующий элемент списка
-        // Возвращает ссылку на самого себя
-        // Инкремент итератора, не указывающего на существующий
-        // элемент списка, приводит к неопределённому поведению
-        BasicIterator& operator++() noexcept {
-            assert(node_ != nullptr);
-            this->node_ = this->node_->next_node;
-            return *this;
-        }
-
-        // Оператор постинкремента. После его вызова итератор
-        // указывает на следующий элемент списка
-        // Возвращает прежнее значение итератора
-        // Инкремент итератора, не указывающего на существующий
-        // элемент списка,
-        // приводит к неопределённому поведению
-        BasicIterator operator++(int) noexcept {
-            auto old_value(*this);
-            ++(*this);
-            return old_value;
-        }
-
-        // Операция разыменования. Возвращает ссылку на текущий
-        // элемент
-        // Вызов этого оператора у итератора, не указывающего на
-        // существующий элемент списка, приводит к неопределённому
-        // поведению
-        [[nodiscard]] reference operator*() const noexcept {
-            assert(node_ != nullptr);
-            return node_->value;
-        }
-
-        // Операция доступа к члену класса. Возвращает указатель на
-        // текущий элемент списка
-        // Вызов этого оператора у итератора, не указывающего на
-        // существующий элемент списка, приводит к неопределённому
-        // поведению
-        [[nodiscard]] pointer operator->() const noexcept {
-            assert(node_ != nullptr);
-            return &node_->value;
-        }
-
-    private:
-        Node* node_ = nullptr;
-    };
-
-public:
-
-    SingleLinkedList() = default;
-
-    SingleLinkedList(std::initializer_list<Type> values) {
-        SingleLinkedList tmp;
-        for (auto value : values) {
-            tmp.PushBack(value);
-        }
-        swap(tmp);
-    }
-
-    SingleLinkedList(const SingleLinkedList& other) {
-        assert(size_ == 0 && head_.next_node == nullptr);
-
-        if (head_.next_node != other.head_.next_node) {
-            SingleLinkedList tmp;
-            for (auto it = other.begin(); it != other.end();
-                 ++it) {
-                tmp.PushBack(*it);
-            }
-            swap(tmp);
-        }
-    }
-
-    // Обменивает содержимое списков за время O(1)
-    void swap(SingleLinkedList& other) noexcept {
-        auto tmp_node = head_.next_node;
-        auto tmp_size = size_;
-
-        head_.next_node = other.head_.next_node;
-        size_ = other.size_;
-
-        other.head_.next_node = tmp_node;
-        other.size_ = tmp_size;
-    }
-
-    SingleLinkedList& operator=(const SingleLinkedList& rhs) {
-        if (head_.next_node != rhs.head_.next_node) {
-            SingleLinkedList tmp;
-            for (auto it = rhs.begin(); it != rhs.end();
-                 ++it) {
-                tmp.PushBack(*it);
-            }
-            Clear();
-            swap(tmp);
-        }
-        return *this;
-    }
-
-    using value_type = Type;
-    using reference = value_type&;
-    using const_reference = const value_type&;
-
-    // Итератор, допускающий изменение элементов списка
-    using Iterator = BasicIterator<Type>;
-    // Константный итератор, предоставляющий доступ для чтения к
-    // элементам списка
-    using ConstIterator = BasicIterator<const Type>;
-
-    // Возвращает итератор, указывающий на позицию перед первым
-    // элементом односвязного списка.
-    // Разыменовывать этот итератор нельзя - попытка разыменования
-    // приведёт к неопределённому поведению
-    [[nodiscard]] Iterator before_begin() noexcept {
-        return Iterator{&head_};
-    }
-
-    // Возвращает константный итератор, указывающий на позицию
-    // перед первым элементом односвязного списка.
-    // Разыменовывать этот итератор нельзя - попытка разыменования
-    // приведёт к неопределённому поведению
-    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
-        return ConstIterator(const_cast<Node*>(&head_)); ;
-    }
-
-    // Возвращает константный итератор, указывающий на позицию
-    // перед первым элементом односвязного списка.
-    // Разыменовывать этот итератор нельзя - попытка разыменования
-    // приведёт к неопределённому поведению
-    [[nodiscard]] ConstIterator before_begin() const noexcept {
-        return ConstIterator{&head_};
-    }
-
-    // Возвращает итератор, ссылающийся на первый элемент
-    // Если список пустой, возвращённый итератор будет равен end()
-    [[nodiscard]] Iterator begin() noexcept {
-        return Iterator{head_.next_node};
-    }
-
-    // Возвращает итератор, указывающий на позицию, следующую за
-    // последним элементом односвязного списка
-    // Разыменовывать этот итератор нельзя — попытка разыменования
-    // приведёт к неопределённому поведению
-    [[nodiscard]] Iterator end() noexcept {
-        return Iterator{nullptr};
-    }
-
-    // Возвращает константный итератор, ссылающийся на первый
-    // элемент
-    // Если список пустой, возвращённый итератор будет равен end()
-    // Результат вызова эквивалентен вызову метода cbegin()
-    [[nodiscard]] ConstIterator begin() const noexcept {
-        return ConstIterator{head_.next_node};
-    }
-
-    // Возвращает константный итератор, указывающий на позицию,
-    // следующую за последним элементом односвязного списка
-    // Разыменовывать этот итератор нельзя — попытка разыменования
-    // приведёт к неопределённому поведению
-    // Результат вызова эквивалентен вызову метода cend()
-    [[nodiscard]] ConstIterator end() const noexcept {
-        return ConstIterator{nullptr};
-    }
-
-    // Возвращает константный итератор, ссылающийся на первый
-    // элемент
-    // Если список пустой, возвращённый итератор будет равен cend()
-    [[nodiscard]] ConstIterator cbegin() const noexcept {
-        return ConstIterator{head_.next_node};
-    }
-
-    // Возвращает константный итератор, указывающий на позицию,
-    // следующую за последним элементом односвязного списка
-    // Разыменовывать этот итератор нельзя — попытка разыменования
-    // приведёт к неопределённому поведению
-    [[nodiscard]] ConstIterator cend() const noexcept {
-        return ConstIterator{nullptr};
-    }
-
-    // Возвращает количество элементов в списке за время O(1)
-    [[nodiscard]] size_t GetSize() const noexcept {
-        return size_;
-    }
-
-    // Сообщает, пустой ли список за время O(1)
-    [[nodiscard]] bool IsEmpty() const noexcept {
-        return size_ == 0;
-    }
-
-    // Вставляет элемент value в начало списка за время O(1)
-    void PushFront(const Type& value) {
-        Node* new_node;
-        try {
-            new_node = new Node(value, head_.next_node);
-        } catch (const std::bad_alloc&) {
-            throw std::bad_alloc();
-        }
-        head_.next_node = new_node;
-        ++size_;
-    }
-
-    void PushBack(const Type& value) {
-        Node* new_node;
-        try {
-            new_node = new Node(value, nullptr);
-        } catch (const std::bad_alloc&) {
-            throw std::bad_alloc();
-        }
-        
-        if (last_node_ != nullptr) {
-            last_node_ -> next_node = new_node;
-        }
-        ++size_;
-        last_node_ = new_node;
-        if (head_.next_node == nullptr) {
-            head_.next_node = last_node_;
-        }
-    }
-
-    /*
-     * Вставляет элемент value после элемента, на который указывает
-     * pos.
-     * Возвращает итератор на вставленный элемент
-     * Если при создании элемента будет выброшено исключение,
-     * список останется в прежнем состоянии
-     */
-    Iterator InsertAfter(ConstIterator pos, const Type& value) {
-        assert(pos.node_ != nullptr);
-
-        Node* ptr_new_node = new Node(value, pos.node_->next_node);
-
-        pos.node_->next_node = ptr_new_node;
-        if (pos.node_->next_node == nullptr) {
-            last_node_ = ptr_new_node;
-        }
-        ++size_;
-        return Iterator{ptr_new_node};
-    }
-
-    void PopFront() noexcept {
-        assert(!IsEmpty());
-
-        Node* ptr_next_node = head_.next_node -> next_node;
-        delete head_.next_node;
-
-        if (ptr_next_node == nullptr) {
-            last_node_ = nullptr;
-        }
-        head_.next_node = ptr_next_node;
-        --size_;
-    }
-
-    /*
-     * Удаляет элемент, следующий за pos.
-     * Возвращает итератор на элемент, следующий за удалённым
-     */
-    Iterator EraseAfter(ConstIterator pos) noexcept {
-        assert(pos.node_ != nullptr &&
-               pos.node_ -> next_node != nullptr);
-
-        Node* ptr_node_after_erase = pos.node_ -> next_node -> next_node;
-        delete pos.node_ -> next_node;
-
-        pos.node_ -> next_node = ptr_node_after_erase;
-        if (ptr_node_after_erase == nullptr) {
-            last_node_ = pos.node_;
-        }
-        --size_;
-        return Iterator{ptr_node_after_erase};
-    }
-
-    // Очищает список за время O(N)
-    void Clear() noexcept {
-        Node* next_node;
-        while (head_.next_node != nullptr) {
-            next_node = head_.next_node -> next_node;
-            delete head_.next_node;
-            head_.next_node = next_node;
-        }
-        size_ = 0;
-    }
-
-    ~SingleLinkedList() {
-        Clear();
-    }
-
-private:
-    // Фиктивный узел, используется для вставки
-    // "перед первым элементом"
-    Node head_;
-    size_t size_ = 0;
-    Node* last_node_ = nullptr;
-};
-
-template <typename Type>
-void swap(SingleLinkedList<Type>& lhs,
-          SingleLinkedList<Type>& rhs) noexcept {
-    lhs.swap(rhs);
-}
-
-template <typename Type>
-bool operator==(const SingleLinkedList<Type>& lhs,
-                const SingleLinkedList<Type>& rhs) {
-    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
-}
-
-template <typename Type>
-bool operator!=(const SingleLinkedList<Type>& lhs,
-                const SingleLinkedList<Type>& rhs) {
-    if (lhs.GetSize() != rhs.GetSize()) { return true; }
-    auto rhs_it = rhs.begin();
-    for (auto it = lhs.begin(); it != lhs.end(); ++it) {
-        if (*it != *rhs_it) { return true; }
-        ++rhs_it;
-    }
-    return false;
-}
-
-template <typename Type>
-bool operator<(const SingleLinkedList<Type>& lhs,
-               const SingleLinkedList<Type>& rhs) {
-    if (std::lexicographical_compare(lhs.begin(), lhs.end(),
-                                     rhs.begin(), rhs.end())) {
-        return true;
-    }
-    return false;
-}
-
-template <typename Type>
-bool operator<=(const SingleLinkedList<Type>& lhs,
-                const SingleLinkedList<Type>& rhs) {
-    if (std::lexicographical_compare(rhs.begin(), rhs.end(),
-                                     lhs.begin(), lhs.end())) {
-        return false;
-    }
-    return true;
-}
-
-template <typename Type>
-bool operator>(const SingleLinkedList<Type>& lhs,
-               const SingleLinkedList<Type>& rhs) {
-    if (std::lexicographical_compare(rhs.begin(), rhs.end(),
-                                     lhs.begin(), lhs.end())) {
-        return true;
-    }
-    return false;
-}
-
-template <typename Type>
-bool operator>=(const SingleLinkedList<Type>& lhs,
-                const SingleLinkedList<Type>& rhs) {
-    if (std::lexicographical_compare(lhs.begin(), lhs.end(),
-                                     rhs.begin(), rhs.end())) {
-        return false;
-    }
-    return true;
-}
-
-
 // Эта функция проверяет работу класса SingleLinkedList
 void Test() {
     struct DeletionSpy {
@@ -600,8 +184,2621 @@ void Test() {
             assert(deletion_counter == 1u);
         }
     }
+
+    // Вставка в конец после очистки и удаления последнего элемента
+    {
+        SingleLinkedList<int> lst{1, 2};
+        lst.PushBack(3);
+        assert((lst == SingleLinkedList<int>{1, 2, 3}));
+        lst.EraseAfter(++lst.cbegin());
+        lst.PushBack(4);
+        assert((lst == SingleLinkedList<int>{1, 2, 4}));
+        lst.Clear();
+        lst.PushBack(5);
+        assert((lst == SingleLinkedList<int>{5}));
+        lst.PopFront();
+        lst.PushFront(6);
+        lst.PushBack(7);
+        assert((lst == SingleLinkedList<int>{6, 7}));
+    }
+}
+
+// Эта функция проверяет работу SingleLinkedList с пулом узлов
+void TestNodePool() {
+    using PooledList = SingleLinkedList<int, PoolAllocator<int>>;
+
+    // Узлы берутся из пула, а удалённые узлы используются повторно
+    {
+        auto pool = std::make_shared<NodePool>(4);
+        PooledList list{PoolAllocator<int>(pool)};
+        for (int i = 0; i < 10; ++i) {
+            list.PushBack(i);
+        }
+        assert(list.GetSize() == 10u);
+        assert(pool->GetChunkCount() == 3u);
+        assert(pool->GetFreeBlockCount() == 0u);
+
+        list.PopFront();
+        list.EraseAfter(list.cbegin());
+        assert(pool->GetFreeBlockCount() == 2u);
+
+        list.PushFront(100);
+        list.InsertAfter(list.cbegin(), 200);
+        assert(pool->GetFreeBlockCount() == 0u);
+        assert(pool->GetChunkCount() == 3u);
+        assert((list == PooledList{100, 200, 1, 3, 4, 5, 6, 7, 8, 9}));
+
+        list.Clear();
+        assert(pool->GetFreeBlockCount() == 10u);
+    }
+
+    // Копии списка и аллокатора разделяют пул
+    {
+        PooledList list{1, 2, 3};
+        PooledList copy(list);
+        assert(copy == list);
+        assert(copy.get_allocator() == list.get_allocator());
+
+        PooledList other{4, 5};
+        other = list;
+        assert(other == list);
+        assert(other.get_allocator() == list.get_allocator());
+
+        PooledList swapped{7};
+        swap(swapped, copy);
+        assert((swapped == PooledList{1, 2, 3}));
+        assert((copy == PooledList{7}));
+    }
+
+    // Строгая гарантия безопасности исключений сохраняется
+    {
+        struct ThrowingValue {
+            ThrowingValue() = default;
+            ThrowingValue(const ThrowingValue& other)
+                : should_throw(other.should_throw) {
+                if (should_throw) {
+                    throw std::bad_alloc();
+                }
+            }
+            bool should_throw = false;
+        };
+
+        auto pool = std::make_shared<NodePool>();
+        SingleLinkedList<ThrowingValue, PoolAllocator<ThrowingValue>> list{
+            PoolAllocator<ThrowingValue>(pool)};
+        list.PushFront(ThrowingValue{});
+        ThrowingValue bad;
+        bad.should_throw = true;
+        try {
+            list.PushFront(bad);
+            assert(false);
+        } catch (const std::bad_alloc&) {
+        }
+        assert(list.GetSize() == 1u);
+        assert(pool->GetFreeBlockCount() == 1u);
+    }
+}
+
+// Эта функция проверяет перемещение списков и элементов
+void TestMoveSemantics() {
+    // Вспомогательный класс, считающий копирования
+    struct CopyCounter {
+        CopyCounter() = default;
+        explicit CopyCounter(int& counter)
+            : counter_ptr(&counter) {
+        }
+        CopyCounter(const CopyCounter& other)
+            : counter_ptr(other.counter_ptr) {
+            if (counter_ptr) {
+                ++(*counter_ptr);
+            }
+        }
+        CopyCounter(CopyCounter&&) noexcept = default;
+        CopyCounter& operator=(const CopyCounter&) = default;
+        CopyCounter& operator=(CopyCounter&&) noexcept = default;
+        int* counter_ptr = nullptr;
+    };
+
+    // Вставка перемещением не копирует элементы
+    {
+        int copies = 0;
+        SingleLinkedList<CopyCounter> list;
+        list.PushFront(CopyCounter(copies));
+        list.PushBack(CopyCounter(copies));
+        list.InsertAfter(list.cbegin(), CopyCounter(copies));
+        assert(list.GetSize() == 3u);
+        assert(copies == 0);
+
+        CopyCounter value(copies);
+        list.PushBack(value);
+        assert(copies == 1);
+    }
+
+    // Элементы, которые нельзя копировать
+    {
+        SingleLinkedList<std::unique_ptr<int>> list;
+        list.PushBack(std::make_unique<int>(2));
+        list.PushFront(std::make_unique<int>(1));
+        list.EmplaceBack(new int(4));
+        list.InsertAfter(++list.cbegin(), std::make_unique<int>(3));
+        int expected = 1;
+        for (const auto& ptr : list) {
+            assert(*ptr == expected++);
+        }
+        assert(list.GetSize() == 4u);
+    }
+
+    // Создание элементов на месте
+    {
+        SingleLinkedList<std::string> list;
+        std::string& front = list.EmplaceFront(3, 'a');
+        assert(front == "aaa");
+        std::string& back = list.EmplaceBack("tail");
+        assert(back == "tail");
+        auto it = list.EmplaceAfter(list.cbegin(), 2, 'b');
+        assert(*it == "bb");
+        assert((list == SingleLinkedList<std::string>{"aaa", "bb", "tail"}));
+        list.EmplaceBack("end");
+        assert((list == SingleLinkedList<std::string>{"aaa", "bb", "tail",
+                                                      "end"}));
+    }
+
+    // Перемещающий конструктор и перемещающее присваивание
+    {
+        int copies = 0;
+        SingleLinkedList<CopyCounter> source;
+        for (int i = 0; i < 5; ++i) {
+            source.EmplaceBack(copies);
+        }
+        const auto first = source.begin();
+
+        SingleLinkedList<CopyCounter> moved(std::move(source));
+        assert(moved.GetSize() == 5u);
+        assert(moved.begin() == first);
+        assert(source.IsEmpty());
+        assert(source.begin() == source.end());
+        source.PushBack(CopyCounter(copies));
+        assert(source.GetSize() == 1u);
+
+        SingleLinkedList<CopyCounter> assigned;
+        assigned.PushBack(CopyCounter(copies));
+        assigned = std::move(moved);
+        assert(assigned.GetSize() == 5u);
+        assert(assigned.begin() == first);
+        assert(moved.IsEmpty());
+        assert(copies == 0);
+
+        std::vector<SingleLinkedList<CopyCounter>> lists;
+        for (int i = 0; i < 10; ++i) {
+            lists.push_back(assigned);
+        }
+        const int copies_before_growth = copies;
+        lists.reserve(lists.capacity() * 2);
+        assert(copies == copies_before_growth);
+
+        static_assert(std::is_nothrow_move_constructible_v<
+                      SingleLinkedList<CopyCounter>>);
+        static_assert(std::is_nothrow_move_assignable_v<
+                      SingleLinkedList<CopyCounter>>);
+    }
+
+    // Перемещение списка с пулом узлов
+    {
+        using PooledList = SingleLinkedList<int, PoolAllocator<int>>;
+        PooledList source{1, 2, 3};
+        const auto pool = source.get_allocator().GetPool();
+        PooledList moved(std::move(source));
+        assert((moved == PooledList{1, 2, 3}));
+        source.PushBack(4);
+        assert(source.get_allocator().GetPool() == pool);
+
+        PooledList other{5};
+        other = std::move(moved);
+        assert((other == PooledList{1, 2, 3}));
+        assert(other.get_allocator().GetPool() == pool);
+    }
+}
+
+// Эта функция проверяет перенос узлов между списками
+void TestSplice() {
+    // Перенос всего списка
+    {
+        SingleLinkedList<int> lst{1, 2, 3};
+        SingleLinkedList<int> other{10, 20};
+        const auto other_first = other.begin();
+        lst.SpliceAfter(lst.cbegin(), other);
+        assert((lst == SingleLinkedList<int>{1, 10, 20, 2, 3}));
+        assert(lst.GetSize() == 5u);
+        assert(other.IsEmpty() && other.begin() == other.end());
+        assert(++lst.begin() == other_first);
+
+        lst.SpliceAfter(lst.cbefore_begin(), SingleLinkedList<int>{0});
+        lst.PushBack(4);
+        assert((lst == SingleLinkedList<int>{0, 1, 10, 20, 2, 3, 4}));
+
+        // Перенос пустого списка и перенос в конец
+        lst.SpliceAfter(lst.cbegin(), other);
+        assert(lst.GetSize() == 7u);
+        SingleLinkedList<int> tail{5, 6};
+        auto last = lst.cbegin();
+        for (size_t i = 1; i < lst.GetSize(); ++i) {
+            ++last;
+        }
+        lst.SpliceAfter(last, tail);
+        lst.PushBack(7);
+        assert((lst == SingleLinkedList<int>{0, 1, 10, 20, 2, 3, 4, 5, 6, 7}));
+
+        other.PushBack(8);
+        assert((other == SingleLinkedList<int>{8}));
+    }
+
+    // Перенос интервала
+    {
+        SingleLinkedList<int> lst{1, 2};
+        SingleLinkedList<int> other{10, 20, 30, 40};
+        lst.SpliceAfter(lst.cbegin(), other, other.cbegin(),
+                        ++(++(++other.cbegin())));
+        assert((lst == SingleLinkedList<int>{1, 20, 30, 2}));
+        assert((other == SingleLinkedList<int>{10, 40}));
+        assert(lst.GetSize() == 4u && other.GetSize() == 2u);
+
+        // Интервал до конца списка-источника
+        lst.SpliceAfter(lst.cbefore_begin(), other, other.cbefore_begin(),
+                        other.cend());
+        assert((lst == SingleLinkedList<int>{10, 40, 1, 20, 30, 2}));
+        assert(other.IsEmpty());
+        other.PushBack(50);
+        assert((other == SingleLinkedList<int>{50}));
+
+        // Пустой интервал
+        lst.SpliceAfter(lst.cbegin(), other, other.cbegin(), other.cend());
+        assert(lst.GetSize() == 6u && other.GetSize() == 1u);
+
+        // Перенос внутри одного списка: хвост переезжает в начало
+        lst.SpliceAfter(lst.cbefore_begin(), lst, ++(++lst.cbegin()),
+                        lst.cend());
+        assert((lst == SingleLinkedList<int>{20, 30, 2, 10, 40, 1}));
+        assert(lst.GetSize() == 6u);
+        lst.PushBack(3);
+        assert((lst == SingleLinkedList<int>{20, 30, 2, 10, 40, 1, 3}));
+    }
+
+    // Дописывание списка в конец
+    {
+        SingleLinkedList<int> lst;
+        lst.Append(SingleLinkedList<int>{1, 2});
+        lst.Append(SingleLinkedList<int>{});
+        lst.Append(SingleLinkedList<int>{3});
+        lst.PushBack(4);
+        assert((lst == SingleLinkedList<int>{1, 2, 3, 4}));
+        assert(lst.GetSize() == 4u);
+    }
+
+    // Перенос между списками с общим пулом не выделяет память
+    {
+        using PooledList = SingleLinkedList<int, PoolAllocator<int>>;
+        auto pool = std::make_shared<NodePool>();
+        PooledList lst{{1, 2}, PoolAllocator<int>(pool)};
+        PooledList other{{3, 4}, PoolAllocator<int>(pool)};
+        const size_t chunks = pool->GetChunkCount();
+        lst.Append(std::move(other));
+        assert((lst == PooledList{{1, 2, 3, 4}, PoolAllocator<int>(pool)}));
+        assert(pool->GetChunkCount() == chunks);
+    }
+}
+
+// Эта функция проверяет работу UnrolledSingleLinkedList
+void TestUnrolledSingleLinkedList() {
+    using List = UnrolledSingleLinkedList<int, 4>;
+
+    // Вставка в конец и в начало заполняет узлы целиком
+    {
+        List lst;
+        for (int i = 0; i < 10; ++i) {
+            lst.PushBack(i);
+        }
+        assert(lst.GetSize() == 10u);
+        assert(lst.GetNodeCount() == 3u);
+        assert((lst == List{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+        List front;
+        for (int i = 0; i < 6; ++i) {
+            front.PushFront(i);
+        }
+        assert((front == List{5, 4, 3, 2, 1, 0}));
+        assert(front.GetNodeCount() == 2u);
+    }
+
+    // Доступ к позиции, предшествующей begin
+    {
+        List empty_list;
+        assert(empty_list.before_begin() == empty_list.cbefore_begin());
+        assert(++empty_list.before_begin() == empty_list.begin());
+        assert(empty_list.begin() == empty_list.end());
+
+        List numbers{1, 2, 3, 4, 5};
+        assert(++numbers.cbefore_begin() == numbers.cbegin());
+    }
+
+    // Вставка после указанной позиции с делением узла
+    {
+        List lst{1, 2, 3, 4};
+        auto it = lst.InsertAfter(lst.cbegin(), 100);
+        assert(*it == 100);
+        assert((lst == List{1, 100, 2, 3, 4}));
+        assert(lst.GetNodeCount() == 2u);
+
+        it = lst.InsertAfter(lst.cbefore_begin(), 0);
+        assert(it == lst.begin());
+        assert((lst == List{0, 1, 100, 2, 3, 4}));
+
+        auto last = lst.cbegin();
+        for (size_t i = 1; i < lst.GetSize(); ++i) {
+            ++last;
+        }
+        it = lst.InsertAfter(last, 5);
+        assert(*it == 5);
+        assert(++it == lst.end());
+        lst.PushBack(6);
+        assert((lst == List{0, 1, 100, 2, 3, 4, 5, 6}));
+        assert(lst.GetSize() == 8u);
+    }
+
+    // Удаление элементов после указанной позиции
+    {
+        List lst{1, 2, 3, 4, 5, 6};
+        auto it = lst.EraseAfter(lst.cbefore_begin());
+        assert(it == lst.begin() && *it == 2);
+        it = lst.EraseAfter(lst.cbegin());
+        assert(*it == 4);
+        assert((lst == List{2, 4, 5, 6}));
+
+        // Удаление единственного элемента узла убирает узел
+        List single{1, 2, 3, 4, 5};
+        it = single.EraseAfter(++(++(++single.cbegin())));
+        assert(it == single.end());
+        assert(single.GetNodeCount() == 1u);
+        single.PushBack(9);
+        assert((single == List{1, 2, 3, 4, 9}));
+
+        while (!single.IsEmpty()) {
+            single.PopFront();
+        }
+        assert(single.GetNodeCount() == 0u);
+        single.PushBack(1);
+        assert((single == List{1}));
+    }
+
+    // Разрушение элементов и копирование
+    {
+        struct DeletionSpy {
+            DeletionSpy() = default;
+            explicit DeletionSpy(int& counter)
+                : counter_ptr(&counter) {
+            }
+            DeletionSpy(const DeletionSpy&) = default;
+            DeletionSpy& operator=(const DeletionSpy&) = default;
+            ~DeletionSpy() {
+                if (counter_ptr) {
+                    ++(*counter_ptr);
+                }
+            }
+            int* counter_ptr = nullptr;
+        };
+        int deletions = 0;
+        {
+            UnrolledSingleLinkedList<DeletionSpy, 4> lst;
+            for (int i = 0; i < 7; ++i) {
+                lst.EmplaceBack();
+            }
+            for (auto& spy : lst) {
+                spy.counter_ptr = &deletions;
+            }
+            lst.PopFront();
+            assert(deletions == 1);
+        }
+        assert(deletions == 7);
+
+        UnrolledSingleLinkedList<std::string, 3> strings{"a", "b", "c", "d"};
+        auto copy = strings;
+        assert(copy == strings);
+        copy.PushFront("z");
+        assert(copy != strings && strings < copy);
+        auto moved = std::move(copy);
+        assert(copy.IsEmpty() && moved.GetSize() == 5u);
+    }
+
+    // Исключение из конструктора элемента при заведении нового узла
+    // не меняет список и не оставляет выделенный узел
+    {
+        struct Fragile {
+            explicit Fragile(int v)
+                : value(v) {
+                if (value < 0) {
+                    throw std::runtime_error("negative value");
+                }
+            }
+            Fragile(const Fragile&) = default;
+            Fragile(Fragile&& other)
+                : value(other.value) {
+                if (value == 13) {
+                    throw std::runtime_error("unlucky move");
+                }
+            }
+            Fragile& operator=(const Fragile&) = default;
+            Fragile& operator=(Fragile&&) = default;
+            int value;
+        };
+        auto values = [](const auto& lst) {
+            std::vector<int> result;
+            for (const Fragile& item : lst) {
+                result.push_back(item.value);
+            }
+            return result;
+        };
+
+        UnrolledSingleLinkedList<Fragile, 2> lst;
+        lst.EmplaceBack(1);
+        lst.EmplaceBack(2);
+        bool thrown = false;
+        try {
+            lst.EmplaceBack(-1);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && (values(lst) == std::vector<int>{1, 2}));
+
+        thrown = false;
+        try {
+            lst.EmplaceAfter(std::next(lst.cbegin()), 13);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && (values(lst) == std::vector<int>{1, 2}));
+        lst.EmplaceBack(3);
+        assert((values(lst) == std::vector<int>{1, 2, 3}));
+    }
+}
+
+// Эта функция проверяет работу ConcurrentSingleLinkedList
+void TestConcurrentSingleLinkedList() {
+    // Стек: элементы извлекаются в обратном порядке
+    {
+        ConcurrentSingleLinkedList<std::string, ConcurrentListMode::kStack>
+            stack;
+        assert(stack.IsEmpty());
+        assert(!stack.TryPopFront().has_value());
+        stack.PushFront("a");
+        stack.PushFront(std::string("b"));
+        stack.EmplaceFront(2, 'c');
+        assert(!stack.IsEmpty());
+        assert(stack.TryPopFront() == "cc");
+        assert(stack.TryPopFront() == "b");
+        assert(stack.TryPopFront() == "a");
+        assert(!stack.TryPopFront().has_value());
+        stack.PushFront("left in destructor");
+    }
+
+    // Очередь: элементы извлекаются в порядке добавления
+    {
+        ConcurrentSingleLinkedList<std::unique_ptr<int>> queue;
+        assert(queue.IsEmpty());
+        assert(!queue.TryPopFront().has_value());
+        for (int i = 0; i < 5; ++i) {
+            queue.PushBack(std::make_unique<int>(i));
+        }
+        assert(!queue.IsEmpty());
+        for (int i = 0; i < 3; ++i) {
+            auto value = queue.TryPopFront();
+            assert(value.has_value() && **value == i);
+        }
+        queue.EmplaceBack(new int(5));
+    }
+
+    // Несколько производителей и потребителей
+    auto check_parallel = [](auto& list, auto push) {
+        constexpr int kThreads = 4;
+        constexpr int kItemsPerThread = 20000;
+        std::atomic<long long> sum = 0;
+        std::atomic<int> popped = 0;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&list, &push, t] {
+                for (int i = 0; i < kItemsPerThread; ++i) {
+                    push(list, t * kItemsPerThread + i);
+                }
+            });
+            threads.emplace_back([&] {
+                while (popped.load() < kThreads * kItemsPerThread) {
+                    if (auto value = list.TryPopFront()) {
+                        sum += *value;
+                        ++popped;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        const long long n = kThreads * kItemsPerThread;
+        assert(popped.load() == n);
+        assert(sum.load() == n * (n - 1) / 2);
+        assert(list.IsEmpty());
+    };
+    {
+        ConcurrentSingleLinkedList<int, ConcurrentListMode::kStack> stack;
+        check_parallel(stack, [](auto& list, int value) {
+            list.PushFront(value);
+        });
+        ConcurrentSingleLinkedList<int> queue;
+        check_parallel(queue, [](auto& list, int value) {
+            list.PushBack(value);
+        });
+    }
+}
+
+// Эта функция проверяет алгоритмы, перецепляющие узлы
+void TestRelinkingAlgorithms() {
+    // Разворот списка
+    {
+        SingleLinkedList<int> lst{1, 2, 3, 4};
+        const auto first = lst.begin();
+        lst.Reverse();
+        assert((lst == SingleLinkedList<int>{4, 3, 2, 1}));
+        lst.PushBack(0);
+        assert((lst == SingleLinkedList<int>{4, 3, 2, 1, 0}));
+        assert(*first == 1);
+
+        SingleLinkedList<int> empty;
+        empty.Reverse();
+        empty.PushBack(1);
+        assert((empty == SingleLinkedList<int>{1}));
+    }
+
+    // Сортировка устойчива и не перемещает элементы
+    {
+        SingleLinkedList<std::pair<int, int>> lst;
+        for (int i = 0; i < 100; ++i) {
+            lst.PushBack({(i * 37) % 10, i});
+        }
+        const std::pair<int, int>* first_address = &*lst.begin();
+        lst.Sort([](const auto& lhs, const auto& rhs) {
+            return lhs.first < rhs.first;
+        });
+        assert(lst.GetSize() == 100u);
+        bool found_first = false;
+        auto prev = lst.begin();
+        for (auto it = ++lst.begin(); it != lst.end(); ++it, ++prev) {
+            assert(prev->first < it->first ||
+                   (prev->first == it->first && prev->second < it->second));
+        }
+        for (const auto& item : lst) {
+            found_first = found_first || &item == first_address;
+        }
+        assert(found_first);
+        lst.PushBack({100, 100});
+        assert(lst.GetSize() == 101u);
+
+        SingleLinkedList<int> numbers{5, 1, 4, 2, 3};
+        numbers.Sort();
+        assert((numbers == SingleLinkedList<int>{1, 2, 3, 4, 5}));
+        numbers.Sort(std::greater<>());
+        assert((numbers == SingleLinkedList<int>{5, 4, 3, 2, 1}));
+        numbers.PushBack(0);
+        assert((numbers == SingleLinkedList<int>{5, 4, 3, 2, 1, 0}));
+    }
+
+    // Исключение в компараторе не теряет элементы
+    {
+        SingleLinkedList<int> lst;
+        for (int i = 0; i < 50; ++i) {
+            lst.PushFront(i);
+        }
+        int comparisons = 0;
+        try {
+            lst.Sort([&comparisons](int lhs, int rhs) {
+                if (++comparisons == 100) {
+                    throw std::runtime_error("comparison failed");
+                }
+                return lhs < rhs;
+            });
+            assert(false);
+        } catch (const std::runtime_error&) {
+        }
+        assert(lst.GetSize() == 50u);
+        lst.Sort();
+        int expected = 0;
+        for (int value : lst) {
+            assert(value == expected++);
+        }
+    }
+
+    // Слияние отсортированных списков
+    {
+        SingleLinkedList<int> lst{1, 3, 5, 7};
+        SingleLinkedList<int> other{2, 3, 8, 9};
+        lst.Merge(other);
+        assert((lst == SingleLinkedList<int>{1, 2, 3, 3, 5, 7, 8, 9}));
+        assert(lst.GetSize() == 8u && other.IsEmpty());
+        lst.PushBack(10);
+        other.PushBack(11);
+        assert((other == SingleLinkedList<int>{11}));
+
+        SingleLinkedList<int> tail_from_this{4, 20};
+        tail_from_this.Merge(SingleLinkedList<int>{5, 6});
+        tail_from_this.PushBack(21);
+        assert((tail_from_this == SingleLinkedList<int>{4, 5, 6, 20, 21}));
+
+        SingleLinkedList<int> empty;
+        empty.Merge(SingleLinkedList<int>{1, 2});
+        empty.PushBack(3);
+        assert((empty == SingleLinkedList<int>{1, 2, 3}));
+    }
+
+    // Удаление подряд идущих дубликатов и элементов по условию
+    {
+        SingleLinkedList<int> lst{1, 1, 2, 3, 3, 3, 1, 4, 4};
+        assert(lst.Unique() == 4u);
+        assert((lst == SingleLinkedList<int>{1, 2, 3, 1, 4}));
+        assert(lst.GetSize() == 5u);
+        lst.PushBack(5);
+        assert((lst == SingleLinkedList<int>{1, 2, 3, 1, 4, 5}));
+
+        assert(lst.Unique([](int lhs, int rhs) {
+            return rhs - lhs < 3;
+        }) == 4u);
+        assert((lst == SingleLinkedList<int>{1, 4}));
+
+        assert(lst.RemoveIf([](int value) {
+            return value > 3;
+        }) == 1u);
+        assert((lst == SingleLinkedList<int>{1}));
+        lst.PushBack(2);
+        assert((lst == SingleLinkedList<int>{1, 2}));
+        assert(lst.RemoveIf([](int) {
+            return true;
+        }) == 2u);
+        assert(lst.IsEmpty());
+        lst.PushBack(3);
+        assert((lst == SingleLinkedList<int>{3}));
+    }
+}
+
+// Эта функция проверяет вставку диапазонов
+void TestRangeInsertion() {
+    // Создание из диапазона и из входного потока
+    {
+        const std::vector<int> values{1, 2, 3, 4};
+        SingleLinkedList<int> lst(values.begin(), values.end());
+        assert((lst == SingleLinkedList<int>{1, 2, 3, 4}));
+        lst.PushBack(5);
+        assert(lst.GetSize() == 5u);
+
+        std::istringstream input("7 8 9");
+        SingleLinkedList<int> from_stream{std::istream_iterator<int>(input),
+                                          std::istream_iterator<int>()};
+        assert((from_stream == SingleLinkedList<int>{7, 8, 9}));
+
+        SingleLinkedList<int> empty(values.end(), values.end());
+        assert(empty.IsEmpty());
+        empty.PushBack(1);
+        assert((empty == SingleLinkedList<int>{1}));
+    }
+
+    // Замена содержимого
+    {
+        SingleLinkedList<std::string> lst{"a", "b"};
+        const std::vector<std::string> values{"x", "y", "z"};
+        lst.Assign(values.begin(), values.end());
+        assert((lst == SingleLinkedList<std::string>{"x", "y", "z"}));
+        lst.PushBack("w");
+        assert(lst.GetSize() == 4u);
+        lst.Assign({"q"});
+        assert((lst == SingleLinkedList<std::string>{"q"}));
+        lst.Assign(values.begin(), values.begin());
+        assert(lst.IsEmpty());
+    }
+
+    // Вставка диапазона после указанной позиции
+    {
+        SingleLinkedList<int> lst{1, 5};
+        const std::vector<int> values{2, 3, 4};
+        auto it = lst.InsertAfter(lst.cbegin(), values.begin(), values.end());
+        assert(*it == 4);
+        assert((lst == SingleLinkedList<int>{1, 2, 3, 4, 5}));
+
+        const std::vector<int> tail{6, 7};
+        auto last = lst.cbegin();
+        for (size_t i = 1; i < lst.GetSize(); ++i) {
+            ++last;
+        }
+        it = lst.InsertAfter(last, tail.begin(), tail.end());
+        assert(++it == lst.end());
+        lst.PushBack(8);
+        assert((lst == SingleLinkedList<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+
+        it = lst.InsertAfter(lst.cbefore_begin(), tail.end(), tail.end());
+        assert(it == lst.before_begin());
+        assert(lst.GetSize() == 8u);
+    }
+
+    // Строгая гарантия безопасности исключений
+    {
+        struct ThrowOnCopy {
+            ThrowOnCopy() = default;
+            ThrowOnCopy(const ThrowOnCopy& other)
+                : should_throw(other.should_throw) {
+                if (should_throw) {
+                    throw std::bad_alloc();
+                }
+            }
+            ThrowOnCopy& operator=(const ThrowOnCopy&) = default;
+            bool should_throw = false;
+        };
+        std::vector<ThrowOnCopy> values(3);
+        values.back().should_throw = true;
+
+        SingleLinkedList<ThrowOnCopy> lst;
+        lst.PushBack(ThrowOnCopy{});
+        lst.PushBack(ThrowOnCopy{});
+        try {
+            lst.InsertAfter(lst.cbegin(), values.begin(), values.end());
+            assert(false);
+        } catch (const std::bad_alloc&) {
+        }
+        assert(lst.GetSize() == 2u);
+        try {
+            lst.Assign(values.begin(), values.end());
+            assert(false);
+        } catch (const std::bad_alloc&) {
+        }
+        assert(lst.GetSize() == 2u);
+    }
+}
+
+// Эта функция проверяет повторное использование узлов
+void TestNodeRecycling() {
+    auto addresses = [](const auto& list) {
+        std::vector<const void*> result;
+        for (const auto& value : list) {
+            result.push_back(&value);
+        }
+        return result;
+    };
+
+    // Присваивание перезаписывает значения в имеющихся узлах
+    {
+        SingleLinkedList<std::string> lst{"a", "b", "c"};
+        const auto old_addresses = addresses(lst);
+
+        const SingleLinkedList<std::string> same_size{"x", "y", "z"};
+        lst = same_size;
+        assert(lst == same_size);
+        assert(addresses(lst) == old_addresses);
+
+        const SingleLinkedList<std::string> shorter{"p", "q"};
+        lst = shorter;
+        assert(lst == shorter && lst.GetSize() == 2u);
+        assert(addresses(lst)[1] == old_addresses[1]);
+        lst.PushBack("r");
+        assert((lst == SingleLinkedList<std::string>{"p", "q", "r"}));
+
+        const SingleLinkedList<std::string> longer{"1", "2", "3", "4", "5"};
+        lst = longer;
+        assert(lst == longer && lst.GetSize() == 5u);
+        assert(addresses(lst)[0] == old_addresses[0]);
+        lst.PushBack("6");
+        assert(lst.GetSize() == 6u);
+
+        lst = SingleLinkedList<std::string>{};
+        assert(lst.IsEmpty());
+        lst.PushBack("7");
+        assert((lst == SingleLinkedList<std::string>{"7"}));
+
+        auto& self = lst;
+        lst = self;
+        assert((lst == SingleLinkedList<std::string>{"7"}));
+    }
+
+    // Очистка с сохранением узлов
+    {
+        SingleLinkedList<int> lst{1, 2, 3};
+        const auto old_addresses = addresses(lst);
+        lst.Clear(kKeepCapacity);
+        assert(lst.IsEmpty() && lst.begin() == lst.end());
+        assert(lst.GetCapacity() == 3u);
+
+        lst.PushFront(4);
+        lst.PushBack(5);
+        lst.InsertAfter(lst.cbegin(), 6);
+        assert((lst == SingleLinkedList<int>{4, 6, 5}));
+        assert(lst.GetCapacity() == 3u);
+        auto new_addresses = addresses(lst);
+        std::sort(new_addresses.begin(), new_addresses.end());
+        auto sorted_old = old_addresses;
+        std::sort(sorted_old.begin(), sorted_old.end());
+        assert(new_addresses == sorted_old);
+
+        lst.PushBack(7);
+        assert(lst.GetCapacity() == 4u);
+        lst.Clear(kKeepCapacity);
+        lst.ShrinkToFit();
+        assert(lst.GetCapacity() == 0u);
+
+        SingleLinkedList<int> other{1};
+        other.Clear(kKeepCapacity);
+        SingleLinkedList<int> moved(std::move(other));
+        assert(moved.GetCapacity() == 1u && other.GetCapacity() == 0u);
+        swap(moved, lst);
+        assert(lst.GetCapacity() == 1u && moved.GetCapacity() == 0u);
+    }
+
+    // Разрушение значений при сохранении узлов
+    {
+        struct DeletionSpy {
+            ~DeletionSpy() {
+                if (counter_ptr) {
+                    ++(*counter_ptr);
+                }
+            }
+            int* counter_ptr = nullptr;
+        };
+        int deletions = 0;
+        SingleLinkedList<DeletionSpy> lst;
+        lst.PushFront(DeletionSpy{});
+        lst.PushFront(DeletionSpy{});
+        for (auto& spy : lst) {
+            spy.counter_ptr = &deletions;
+        }
+        lst.Clear(kKeepCapacity);
+        assert(deletions == 2);
+    }
+
+    // Пул видит освобождение только лишних узлов
+    {
+        auto pool = std::make_shared<NodePool>();
+        using PooledList = SingleLinkedList<int, PoolAllocator<int>>;
+        PooledList lst{{1, 2, 3, 4}, PoolAllocator<int>(pool)};
+        const PooledList shorter{{5, 6}, PoolAllocator<int>(pool)};
+        lst = shorter;
+        assert(pool->GetFreeBlockCount() == 2u);
+        lst.Clear(kKeepCapacity);
+        assert(pool->GetFreeBlockCount() == 2u);
+        lst.ShrinkToFit();
+        assert(pool->GetFreeBlockCount() == 4u);
+    }
+
+    // Кэш узлов: очередь в установившемся режиме не выделяет память
+    {
+        using CountedList =
+            SingleLinkedList<int, std::allocator<int>, CountingListStats>;
+        CountedList queue;
+        assert(queue.GetNodeCacheSize() == 0u);
+        queue.Reserve(4);
+        assert(queue.GetNodeCacheSize() == 4u);
+        assert(queue.GetCachedNodeCount() == 4u && queue.GetCapacity() == 4u);
+        for (int i = 0; i < 1000; ++i) {
+            queue.PushBack(i);
+            queue.PushBack(i + 1);
+            queue.PopFront();
+            queue.PopFront();
+        }
+        assert(queue.IsEmpty() && queue.GetCachedNodeCount() == 4u);
+        assert(queue.GetStats().node_allocations == 4);
+        assert(queue.GetStats().node_deallocations == 0);
+
+        // Кэш не растёт сверх заданного размера
+        queue.Assign({1, 2, 3, 4, 5, 6});
+        assert(queue.GetStats().node_allocations == 6);
+        queue.Clear();
+        assert(queue.GetCachedNodeCount() == 4u);
+        assert(queue.GetStats().node_deallocations == 2);
+        queue.SetNodeCacheSize(1);
+        assert(queue.GetCachedNodeCount() == 1u);
+        assert(queue.GetStats().node_deallocations == 5);
+
+        // Без кэша удалённые узлы освобождаются
+        queue.SetNodeCacheSize(0);
+        queue.PushBack(1);
+        queue.PopFront();
+        assert(queue.GetCachedNodeCount() == 0u);
+
+        // Размер кэша переходит вместе с узлами при перемещении
+        CountedList cached;
+        cached.SetNodeCacheSize(8);
+        cached.PushBack(1);
+        cached.PopFront();
+        CountedList moved(std::move(cached));
+        assert(moved.GetNodeCacheSize() == 8u);
+        assert(moved.GetCachedNodeCount() == 1u);
+        assert(CountedList(moved).GetNodeCacheSize() == 0u);
+    }
+}
+
+void TestListStats() {
+    // Выключенная статистика не занимает места
+    static_assert(sizeof(SingleLinkedList<int>) ==
+                  sizeof(SingleLinkedList<int, std::allocator<int>,
+                                          NoListStats>));
+    static_assert(sizeof(SingleLinkedList<int>::ConstIterator) ==
+                  sizeof(void*));
+    // Пустой аллокатор тоже не занимает места: список — это фиктивный
+    // узел, два указателя, три счётчика и номер версии
+    static_assert(sizeof(SingleLinkedList<int>) ==
+                  4 * sizeof(void*) + 3 * sizeof(size_t) + sizeof(uint64_t));
+    {
+        SingleLinkedList<int> lst{1, 2, 3};
+        const ListStats stats = lst.GetStats();
+        assert(stats.node_allocations == 0 && stats.max_size == 0);
+    }
+
+    using CountedList =
+        SingleLinkedList<int, std::allocator<int>, CountingListStats>;
+
+    // Счётчики операций
+    {
+        CountedList lst;
+        lst.GetStatsPolicy().SetName("test-ops");
+        lst.PushBack(2);
+        lst.PushFront(1);
+        lst.EmplaceBack(4);
+        lst.InsertAfter(std::next(lst.cbegin()), 3);
+        const int more[] = {5, 6};
+        lst.InsertAfter(std::next(lst.cbegin(), 3), std::begin(more),
+                        std::end(more));
+        lst.EraseAfter(lst.cbefore_begin());
+        lst.PopFront();
+
+        ListStats stats = lst.GetStats();
+        assert(stats.push_front == 1 && stats.push_back == 2);
+        assert(stats.insert_after == 2 && stats.erase_after == 1);
+        assert(stats.pop_front == 1);
+        assert(stats.node_allocations == 6);
+        assert(stats.node_deallocations == 2);
+        assert(stats.max_size == 6);
+
+        // Шаги считаются только у итераторов, полученных от begin
+        const uint64_t traversals = stats.traversals;
+        int sum = 0;
+        for (int value : lst) {
+            sum += value;
+        }
+        assert(sum == 3 + 4 + 5 + 6);
+        stats = lst.GetStats();
+        assert(stats.traversals == traversals + 1);
+        assert(stats.traversal_steps >= 4);
+
+        // Узлы, сохранённые Clear(kKeepCapacity), не освобождаются
+        lst.Clear(kKeepCapacity);
+        lst.PushBack(7);
+        stats = lst.GetStats();
+        assert(stats.node_allocations == 6);
+        assert(stats.node_deallocations == 2);
+        lst.ShrinkToFit();
+        assert(lst.GetStats().node_deallocations == 5);
+    }
+
+    // Реестр хранит итоги уничтоженных списков и живые списки
+    {
+        auto stats = ListStatsRegistry::Instance().Snapshot();
+        assert(stats.count("test-ops") == 1);
+        assert(stats["test-ops"].node_allocations ==
+               stats["test-ops"].node_deallocations);
+
+        CountedList live;
+        live.GetStatsPolicy().SetName("test-live");
+        live.PushBack(1);
+        CountedList copy = live;
+        assert(copy.GetStatsPolicy().GetName() == "test-live");
+        assert(copy.GetStats().push_back == 0);
+        assert(copy.GetStats().node_allocations == 1);
+
+        stats = ListStatsRegistry::Instance().Snapshot();
+        assert(stats["test-live"].node_allocations == 2);
+        assert(stats["test-live"].push_back == 1);
+
+        std::ostringstream json;
+        ListStatsRegistry::Instance().WriteJson(json);
+        assert(json.str().find("\"name\": \"test-live\"") !=
+               std::string::npos);
+        assert(json.str().find("\"node_allocations\": 2") !=
+               std::string::npos);
+    }
+    // Шаги итератора засчитываются списку, от которого он получен,
+    // и после обмена, и после перемещения узлов в другой список
+    {
+        CountedList lst{1, 2, 3};
+        CountedList other{4};
+        auto it = lst.begin();
+        const uint64_t steps = lst.GetStats().traversal_steps;
+        lst.swap(other);
+        ++it;
+        assert(*it == 2);
+        assert(lst.GetStats().traversal_steps == steps + 1);
+        assert(other.GetStats().traversal_steps == 0);
+
+        CountedList target;
+        CountedList source{5, 6, 7};
+        it = source.begin();
+        const uint64_t source_steps = source.GetStats().traversal_steps;
+        target = std::move(source);
+        ++it;
+        assert(*it == 6 && *++it == 7);
+        assert(source.GetStats().traversal_steps == source_steps + 2);
+        assert(target.GetStats().traversal_steps == 0);
+    }
+}
+
+void TestSerialization() {
+    struct Point {
+        int32_t x;
+        int32_t y;
+        bool operator==(const Point& rhs) const {
+            return x == rhs.x && y == rhs.y;
+        }
+    };
+    // Тип с выравниванием больше заголовка проверяет смещение данных
+    struct alignas(32) Wide {
+        uint64_t value;
+    };
+
+    // Запись и чтение через поток
+    {
+        SingleLinkedList<Point> lst;
+        for (int32_t i = 0; i < 5000; ++i) {
+            lst.PushBack({i, -i});
+        }
+        std::stringstream stream;
+        lst.Serialize(stream);
+        assert(stream.str().size() ==
+               sizeof(SerializedListHeader) + 5000 * sizeof(Point));
+        const auto restored = SingleLinkedList<Point>::Deserialize(stream);
+        assert(restored.GetSize() == 5000u);
+        assert(std::equal(lst.begin(), lst.end(), restored.begin(),
+                          restored.end()));
+    }
+    {
+        const SingleLinkedList<int> empty{};
+        std::stringstream stream;
+        empty.Serialize(stream);
+        assert(SingleLinkedList<int>::Deserialize(stream).IsEmpty());
+    }
+    {
+        SingleLinkedList<Wide> lst;
+        lst.PushBack({1});
+        lst.PushBack({2});
+        std::stringstream stream;
+        lst.Serialize(stream);
+        assert(stream.str().size() == 32 + 2 * sizeof(Wide));
+        const auto restored = SingleLinkedList<Wide>::Deserialize(stream);
+        assert(restored.GetSize() == 2u && restored.begin()->value == 1u);
+    }
+
+    // Повреждённые данные
+    {
+        SingleLinkedList<int> lst{1, 2, 3};
+        std::stringstream stream;
+        lst.Serialize(stream);
+        const std::string bytes = stream.str();
+
+        std::stringstream truncated(bytes.substr(0, bytes.size() - 1));
+        bool thrown = false;
+        try {
+            (void)SingleLinkedList<int>::Deserialize(truncated);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+
+        std::stringstream wrong_type(bytes);
+        thrown = false;
+        try {
+            (void)SingleLinkedList<int64_t>::Deserialize(wrong_type);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    // Отображение снимка в память
+    {
+        const auto path = std::filesystem::temp_directory_path() /
+                          "single-linked-list-test.bin";
+        SingleLinkedList<Point> lst{{1, 2}, {3, 4}, {5, 6}};
+        {
+            std::ofstream out(path, std::ios::binary);
+            lst.Serialize(out);
+        }
+        MappedSingleLinkedList<Point> mapped(path.string());
+        assert(mapped.GetSize() == 3u && !mapped.IsEmpty());
+        assert(std::equal(mapped.cbegin(), mapped.cend(), lst.cbegin(),
+                          lst.cend()));
+
+        MappedSingleLinkedList<Point> moved = std::move(mapped);
+        assert(mapped.IsEmpty() && mapped.begin() == mapped.end());
+        assert(moved.GetSize() == 3u && moved.begin()->x == 1);
+
+        bool thrown = false;
+        try {
+            MappedSingleLinkedList<int32_t> wrong(path.string());
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        std::filesystem::remove(path);
+
+        thrown = false;
+        try {
+            MappedSingleLinkedList<Point> missing(path.string());
+        } catch (const std::system_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+}
+
+void TestIntrusiveSingleLinkedList() {
+    struct Item {
+        explicit Item(int v)
+            : value(v) {
+        }
+        int value;
+        IntrusiveListHook hook;
+        // Второе поле связи позволяет состоять ещё в одном списке
+        IntrusiveListHook other_hook;
+    };
+    using List = IntrusiveSingleLinkedList<Item, &Item::hook>;
+    using OtherList = IntrusiveSingleLinkedList<Item, &Item::other_hook>;
+
+    auto values = [](const auto& lst) {
+        std::vector<int> result;
+        for (const Item& item : lst) {
+            result.push_back(item.value);
+        }
+        return result;
+    };
+
+    std::vector<Item> arena;
+    for (int i = 0; i < 6; ++i) {
+        arena.emplace_back(i);
+    }
+
+    // Вставка, удаление и поиск объекта по полю связи
+    {
+        List lst;
+        assert(lst.IsEmpty() && lst.begin() == lst.end());
+        lst.PushBack(arena[1]);
+        lst.PushFront(arena[0]);
+        lst.PushBack(arena[3]);
+        auto it = lst.InsertAfter(std::next(lst.cbegin()), arena[2]);
+        assert(&*it == &arena[2] && it->value == 2);
+        assert(lst.GetSize() == 4u);
+        assert((values(lst) == std::vector<int>{0, 1, 2, 3}));
+
+        auto next = lst.EraseAfter(lst.cbegin());
+        assert(&*next == &arena[2]);
+        assert(arena[1].hook.next == nullptr);
+        lst.PopFront();
+        assert((values(lst) == std::vector<int>{2, 3}));
+
+        // После удаления последнего элемента PushBack цепляет к
+        // новому последнему
+        lst.EraseAfter(lst.cbegin());
+        lst.PushBack(arena[4]);
+        assert((values(lst) == std::vector<int>{2, 4}));
+
+        // Изменение через итератор меняет сам объект
+        lst.begin()->value = 20;
+        assert(arena[2].value == 20);
+        arena[2].value = 2;
+    }
+
+    // Один объект в двух списках через разные поля связи, перемещение
+    {
+        List first;
+        OtherList second;
+        for (Item& item : arena) {
+            first.PushBack(item);
+            second.PushFront(item);
+        }
+        assert((values(first) == std::vector<int>{0, 1, 2, 3, 4, 5}));
+        assert((values(second) == std::vector<int>{5, 4, 3, 2, 1, 0}));
+
+        List moved = std::move(first);
+        assert(first.IsEmpty() && moved.GetSize() == 6u);
+        moved.Clear();
+        assert(moved.IsEmpty() && arena[0].hook.next == nullptr);
+        assert(second.GetSize() == 6u);
+    }
+}
+
+template <typename Type>
+void CheckSimdKernels() {
+    // Длины покрывают пустой блок, неполные векторы и остатки
+    for (const size_t size : {0, 1, 3, 4, 7, 8, 15, 16, 17, 33, 100, 1000}) {
+        std::vector<Type> values(size);
+        for (size_t i = 0; i < size; ++i) {
+            values[i] = static_cast<Type>((i * 7919) % 50);
+        }
+        const Type* data = values.data();
+        for (const Type needle : {Type(0), Type(7), Type(49), Type(99)}) {
+            const auto expected =
+                std::find(values.begin(), values.end(), needle);
+            assert(SimdKernels::Find(data, size, needle) ==
+                   static_cast<size_t>(expected - values.begin()));
+            assert(SimdKernels::Count(data, size, needle) ==
+                   static_cast<size_t>(
+                       std::count(values.begin(), values.end(), needle)));
+        }
+        assert(SimdKernels::Sum(data, size, Type(1)) ==
+               std::accumulate(values.begin(), values.end(), Type(1)));
+        if (size != 0) {
+            const auto [min, max] =
+                std::minmax_element(values.begin(), values.end());
+            assert((SimdKernels::MinMax(data, size) ==
+                    std::pair<Type, Type>{*min, *max}));
+        }
+        std::vector<Type> copy = values;
+        assert(SimdKernels::Equal(data, copy.data(), size));
+        if (size != 0) {
+            copy[size / 2] = Type(77);
+            assert(!SimdKernels::Equal(data, copy.data(), size));
+        }
+    }
+}
+
+void TestSearchKernels() {
+    static_assert(SimdKernels::kAccelerated<int32_t>);
+    static_assert(SimdKernels::kAccelerated<float>);
+    static_assert(!SimdKernels::kAccelerated<bool>);
+    static_assert(!SimdKernels::kAccelerated<std::string>);
+    CheckSimdKernels<int32_t>();
+    CheckSimdKernels<uint32_t>();
+    CheckSimdKernels<float>();
+    CheckSimdKernels<double>();
+    CheckSimdKernels<int16_t>();
+    CheckSimdKernels<int64_t>();
+    CheckSimdKernels<long double>();
+
+    // Развёрнутый список: узлы разной заполненности
+    {
+        UnrolledSingleLinkedList<int32_t, 8> lst;
+        for (int32_t i = 0; i < 100; ++i) {
+            lst.PushBack(i % 10);
+        }
+        auto it = lst.Find(7);
+        assert(it != lst.end() && *it == 7);
+        assert(std::distance(lst.begin(), it) == 7);
+        assert(lst.Find(42) == lst.end());
+        assert(lst.Count(3) == 10u);
+        assert(lst.Contains(9) && !lst.Contains(10));
+        assert(lst.Sum() == 450);
+        assert((lst.MinMax() == std::pair<int32_t, int32_t>{0, 9}));
+        *lst.Find(0) = -5;
+        assert(lst.MinMax().first == -5);
+
+        // Равные списки с разным разбиением на узлы
+        UnrolledSingleLinkedList<int32_t, 8> split;
+        split.PushBack(-5);
+        for (int32_t i = 99; i >= 1; --i) {
+            split.InsertAfter(split.cbegin(), i % 10);
+        }
+        assert(split.GetNodeCount() != lst.GetNodeCount());
+        assert(split == lst);
+        *std::next(split.begin(), 60) = 100;
+        assert(split != lst);
+    }
+    {
+        const UnrolledSingleLinkedList<std::string> lst{"a", "b", "a"};
+        assert(lst.Count("a") == 2u && lst.Contains("b"));
+        assert(lst.Sum() == "aba");
+        assert((lst.MinMax() ==
+                std::pair<std::string, std::string>{"a", "b"}));
+    }
+
+    // Обычный список
+    {
+        SingleLinkedList<float> lst{3.f, 1.f, 4.f, 1.f, 5.f};
+        assert(*lst.Find(4.f) == 4.f && lst.Find(2.f) == lst.end());
+        assert(lst.Count(1.f) == 2u);
+        assert(lst.Contains(5.f) && !lst.Contains(9.f));
+        assert(lst.Sum() == 14.f);
+        assert((lst.MinMax() == std::pair<float, float>{1.f, 5.f}));
+        *lst.Find(1.f) = 2.f;
+        assert(lst.Count(1.f) == 1u);
+
+        const SingleLinkedList<float> same{3.f, 2.f, 4.f, 1.f, 5.f};
+        const SingleLinkedList<float> shorter{3.f, 2.f, 4.f};
+        assert(lst == same && !(lst != same));
+        assert(lst != shorter && !(lst == shorter));
+    }
+
+    // Снимок в памяти
+    {
+        SingleLinkedList<int32_t> lst;
+        for (int32_t i = 0; i < 1000; ++i) {
+            lst.PushBack(i);
+        }
+        const auto path = std::filesystem::temp_directory_path() /
+                          "single-linked-list-search-test.bin";
+        {
+            std::ofstream out(path, std::ios::binary);
+            lst.Serialize(out);
+        }
+        const MappedSingleLinkedList<int32_t> mapped(path.string());
+        const MappedSingleLinkedList<int32_t> other(path.string());
+        std::filesystem::remove(path);
+        assert(*mapped.Find(500) == 500 && mapped.Find(-1) == mapped.end());
+        assert(mapped.Count(999) == 1u && mapped.Contains(0));
+        assert(mapped.Sum(int32_t{0}) == 999 * 1000 / 2);
+        assert((mapped.MinMax() == std::pair<int32_t, int32_t>{0, 999}));
+        assert(mapped == other);
+    }
+}
+
+void TestParallelAlgorithms() {
+    using List = SingleLinkedList<int>;
+    List lst;
+    for (int i = 0; i < 1000; ++i) {
+        lst.PushBack(i);
+    }
+
+    // Индекс делит список на участки
+    {
+        const auto index = lst.BuildChunkIndex(300);
+        assert(index.GetChunkCount() == 4u && index.GetChunkSize() == 300u);
+        assert(index.IsValidFor(lst));
+        const auto [first, last] = std::as_const(lst).GetChunk(index, 3);
+        assert(*first == 900 && last == lst.cend());
+        assert(std::distance(first, last) == 100);
+        assert(*lst.GetChunk(index, 1).second == 600);
+
+        const List empty{};
+        assert(empty.BuildChunkIndex(10).GetChunkCount() == 0u);
+    }
+
+    // Индекс устаревает при изменении структуры списка, но не
+    // значений элементов
+    {
+        List other;
+        auto index = lst.BuildChunkIndex(300);
+        *lst.begin() = 0;
+        assert(index.IsValidFor(lst));
+        assert(!index.IsValidFor(other));
+
+        auto check_invalidates = [&](auto mutate) {
+            index = lst.BuildChunkIndex(300);
+            mutate();
+            assert(!index.IsValidFor(lst));
+        };
+        check_invalidates([&] { lst.PushBack(1000); });
+        check_invalidates([&] { lst.PopFront(); });
+        check_invalidates([&] { lst.PushFront(0); });
+        check_invalidates([&] { lst.EraseAfter(lst.cbegin()); });
+        check_invalidates([&] { lst.InsertAfter(lst.cbegin(), 1); });
+        check_invalidates([&] { lst.Reverse(); });
+        check_invalidates([&] { lst.Sort(); });
+        check_invalidates([&] { lst.RemoveIf([](int v) { return v == 1000; }); });
+        check_invalidates([&] {
+            other.SpliceAfter(other.cbefore_begin(), lst);
+        });
+        check_invalidates([&] { lst.swap(other); });
+        assert(lst.GetSize() == 1000u && other.IsEmpty());
+    }
+
+    WorkStealingPool pool(4);
+    assert(pool.GetThreadCount() == 4u);
+    const auto index = lst.BuildChunkIndex(64);
+
+    // Свёртка, подсчёт и обход дают те же результаты, что и
+    // последовательные алгоритмы
+    {
+        assert(ParallelReduce(lst, index, 0LL, std::plus<>{}, pool) ==
+               999LL * 1000 / 2);
+        assert(ParallelCount(lst, index, [](int v) { return v % 3 == 0; },
+                             pool) == 334u);
+        // Некоммутативная операция: участки сворачиваются по порядку
+        SingleLinkedList<std::string> digits;
+        std::string expected;
+        for (int i = 0; i < 500; ++i) {
+            digits.PushBack(std::to_string(i % 10));
+            expected += std::to_string(i % 10);
+        }
+        assert(ParallelReduce(digits, digits.BuildChunkIndex(7),
+                              std::string{}, std::plus<>{},
+                              pool) == expected);
+
+        ParallelForEach(lst, index, [](int& v) { v *= 2; }, pool);
+        assert(index.IsValidFor(lst));
+        assert(lst.Sum() == 999 * 1000);
+        const List& const_lst = lst;
+        std::atomic<int> visited = 0;
+        ParallelForEach(const_lst, index, [&](const int&) { ++visited; },
+                        pool);
+        assert(visited == 1000);
+    }
+
+    // Исключение из задачи выбрасывается вызывающему потоку после
+    // завершения остальных задач
+    {
+        std::atomic<size_t> finished = 0;
+        bool thrown = false;
+        try {
+            pool.ParallelFor(100, [&](size_t i) {
+                if (i == 42) {
+                    throw std::runtime_error("task failed");
+                }
+                ++finished;
+            });
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && finished == 99u);
+    }
+
+    // Пул из одного потока выполняет всё в вызывающем потоке
+    {
+        WorkStealingPool single(1);
+        assert(ParallelCount(lst, index, [](int) { return true; },
+                             single) == 1000u);
+    }
+}
+
+void TestSmallSingleLinkedList() {
+    using List = SmallSingleLinkedList<int, 4>;
+    auto values = [](const auto& lst) {
+        return std::vector<int>(lst.begin(), lst.end());
+    };
+
+    // Первые N узлов живут внутри объекта списка
+    {
+        List lst;
+        assert(lst.IsEmpty() && lst.begin() == lst.end());
+        lst.PushBack(2);
+        lst.PushFront(1);
+        lst.PushBack(4);
+        auto it = lst.InsertAfter(std::next(lst.cbegin()), 3);
+        assert(*it == 3);
+        assert((values(lst) == std::vector<int>{1, 2, 3, 4}));
+        assert(lst.GetSize() == 4u && lst.GetHeapNodeCount() == 0u);
+
+        // Пятый узел выделяется в куче
+        lst.PushBack(5);
+        assert(lst.GetHeapNodeCount() == 1u);
+
+        // Освободившаяся ячейка используется следующей вставкой, а
+        // итераторы на другие элементы остаются действительными
+        auto three = std::next(lst.begin(), 2);
+        assert(*lst.EraseAfter(lst.cbegin()) == 3);
+        lst.PushFront(0);
+        assert(lst.GetHeapNodeCount() == 1u);
+        assert(*three == 3);
+        assert((values(lst) == std::vector<int>{0, 1, 3, 4, 5}));
+
+        lst.PopFront();
+        lst.PopFront();
+        assert((values(lst) == std::vector<int>{3, 4, 5}));
+        lst.Clear();
+        assert(lst.IsEmpty() && lst.GetHeapNodeCount() == 0u);
+        lst.PushBack(7);
+        assert(lst.GetSize() == 1u && *lst.begin() == 7);
+    }
+
+    // Копирование, перемещение и обмен переносят и встроенные узлы,
+    // и узлы из кучи
+    {
+        List lst{1, 2, 3, 4, 5, 6};
+        lst.EraseAfter(lst.cbegin());
+        lst.PushBack(7);
+        const std::vector<int> expected{1, 3, 4, 5, 6, 7};
+        assert(values(lst) == expected);
+
+        List copy = lst;
+        assert(copy == lst && !(copy < lst));
+        List moved(std::move(copy));
+        assert(copy.IsEmpty() && values(moved) == expected);
+        moved.PushBack(8);
+        assert(moved != lst && lst < moved);
+
+        List other{9};
+        swap(other, moved);
+        assert((values(other) == std::vector<int>{1, 3, 4, 5, 6, 7, 8}));
+        assert((values(moved) == std::vector<int>{9}));
+        other = std::move(moved);
+        assert((values(other) == std::vector<int>{9}));
+        assert(moved.IsEmpty());
+        other = lst;
+        assert(other == lst && other.GetHeapNodeCount() == 2u);
+        other.swap(other);
+        assert(other == lst);
+    }
+
+    // Элементы разрушаются ровно один раз, а исключение при создании
+    // элемента оставляет список и его ячейки в прежнем состоянии
+    {
+        static int alive = 0;
+        struct Tracked {
+            explicit Tracked(int v, bool fail = false)
+                : value(v) {
+                if (fail) {
+                    throw std::runtime_error("construction failed");
+                }
+                ++alive;
+            }
+            Tracked(const Tracked& other)
+                : value(other.value) {
+                ++alive;
+            }
+            Tracked(Tracked&& other) noexcept
+                : value(other.value) {
+                ++alive;
+            }
+            ~Tracked() {
+                --alive;
+            }
+            int value;
+        };
+        {
+            SmallSingleLinkedList<Tracked, 2> lst;
+            lst.EmplaceBack(1);
+            bool thrown = false;
+            try {
+                lst.EmplaceBack(2, true);
+            } catch (const std::runtime_error&) {
+                thrown = true;
+            }
+            assert(thrown && lst.GetSize() == 1u && alive == 1);
+            lst.EmplaceBack(2);
+            lst.EmplaceBack(3);
+            assert(lst.GetHeapNodeCount() == 1u && alive == 3);
+            auto moved = std::move(lst);
+            assert(alive == 3 && moved.begin()->value == 1);
+            SmallSingleLinkedList<Tracked, 2> copy(moved);
+            assert(alive == 6);
+        }
+        assert(alive == 0);
+    }
+}
+
+// Список собирается, изменяется и сравнивается при вычислении на
+// этапе компиляции
+constexpr int EvaluateConstexprList() {
+    SingleLinkedList<int> lst{3, 1, 2};
+    lst.PushFront(0);
+    lst.PushBack(4);
+    SingleLinkedList<int> sorted = lst;
+    sorted.Sort();
+    int sum = 0;
+    for (const int value : sorted) {
+        sum += value;
+    }
+    SingleLinkedList<int> moved(std::move(sorted));
+    moved.EraseAfter(moved.cbegin());
+    moved.InsertAfter(moved.cbegin(), 9);
+    moved.PopFront();
+    moved.Clear(kKeepCapacity);
+    moved.PushBack(1);
+    return sum * 100 + static_cast<int>(lst.GetSize()) * 10 +
+           (lst == lst) + (lst < moved) * 2 + (lst != moved) * 4;
+}
+
+static_assert(EvaluateConstexprList() == 1057);
+
+constexpr StaticSingleLinkedList<int, 8> kStaticPrimes{2, 3, 5, 7, 11};
+
+static_assert(kStaticPrimes.GetSize() == 5 && !kStaticPrimes.IsFull());
+static_assert(*kStaticPrimes.begin() == 2);
+static_assert(kStaticPrimes.Contains(11) && !kStaticPrimes.Contains(4));
+static_assert(*++kStaticPrimes.Find(5) == 7);
+
+constexpr StaticSingleLinkedList<int, 3> BuildStaticList() {
+    StaticSingleLinkedList<int, 3> lst;
+    lst.PushBack(2);
+    lst.PushFront(1);
+    lst.PushBack(3);
+    lst.EraseAfter(lst.cbegin());
+    lst.InsertAfter(lst.cbegin(), 4);
+    return lst;
+}
+
+static_assert(BuildStaticList() ==
+              StaticSingleLinkedList<int, 3>{1, 4, 3});
+static_assert(BuildStaticList().IsFull());
+
+void TestConstexprLists() {
+    // Те же операции во время выполнения дают тот же результат
+    assert(EvaluateConstexprList() == 1057);
+
+    StaticSingleLinkedList<int, 3> lst = BuildStaticList();
+    assert((std::vector<int>(lst.begin(), lst.end()) ==
+            std::vector<int>{1, 4, 3}));
+    bool thrown = false;
+    try {
+        lst.PushBack(5);
+    } catch (const std::length_error&) {
+        thrown = true;
+    }
+    assert(thrown && lst.GetSize() == 3u);
+
+    // Освобождённые узлы используются повторно, копия не зависит от
+    // исходного списка
+    lst.PopFront();
+    lst.PushBack(5);
+    const StaticSingleLinkedList<int, 3> copy = lst;
+    lst.Clear();
+    lst.PushFront(6);
+    assert((std::vector<int>(copy.begin(), copy.end()) ==
+            std::vector<int>{4, 3, 5}));
+    assert(lst.GetSize() == 1u && *lst.begin() == 6);
+    assert(copy < lst && lst != copy);
+
+    StaticSingleLinkedList<std::string, 2> strings{"a"};
+    strings.PushBack("b");
+    strings.PopFront();
+    assert(*strings.begin() == "b" && *strings.Find("b") == "b");
+}
+
+void TestRanges() {
+    using List = SingleLinkedList<int>;
+    static_assert(std::forward_iterator<List::Iterator>);
+    static_assert(std::forward_iterator<List::ConstIterator>);
+    static_assert(std::sentinel_for<std::default_sentinel_t, List::Iterator>);
+    static_assert(std::ranges::forward_range<List>);
+    static_assert(std::ranges::forward_range<const List>);
+    static_assert(std::ranges::common_range<List>);
+
+    const List lst{1, 2, 3, 4, 5, 6, 7, 8};
+    assert(lst.begin() != std::default_sentinel);
+    assert(List{}.begin() == std::default_sentinel);
+
+    // Цепочка не вычисляется, пока её не обходят
+    int transformed = 0;
+    auto pipeline = lst
+                    | std::views::filter([](int v) { return v % 2 == 0; })
+                    | std::views::transform([&transformed](int v) {
+                          ++transformed;
+                          return v * v;
+                      })
+                    | std::views::take(3);
+    assert(transformed == 0);
+
+    // To обходит цепочку один раз. Конец take не совпадает по типу с
+    // итератором
+    const List squares = pipeline | To<SingleLinkedList>();
+    assert(transformed == 3);
+    assert((squares == List{4, 16, 36}));
+    assert(squares.GetSize() == 3u);
+
+    // Диапазон с концом std::default_sentinel
+    const List prefix(kFromRange,
+                      std::ranges::subrange(
+                          std::counted_iterator(lst.begin(), 2),
+                          std::default_sentinel));
+    assert((prefix == List{1, 2}));
+
+    // Элементы другого типа и алгоритмы std::ranges
+    const auto strings = lst
+                         | std::views::transform([](int v) {
+                               return std::to_string(v);
+                           })
+                         | std::views::drop(6)
+                         | To<SingleLinkedList>();
+    assert((strings == SingleLinkedList<std::string>{"7", "8"}));
+    assert(std::ranges::find(lst, 5) != lst.end());
+    assert(std::ranges::count_if(lst, [](int v) { return v > 4; }) == 4);
+    assert(std::ranges::distance(lst) == 8);
+}
+
+void TestPersistentSingleLinkedList() {
+    using List = PersistentSingleLinkedList<int>;
+    auto values = [](const List& lst) {
+        return std::vector<int>(lst.begin(), lst.end());
+    };
+
+    // Новые версии разделяют хвост со старыми, старые не меняются
+    {
+        const List empty;
+        assert(empty.IsEmpty() && empty.begin() == empty.end());
+        const List v1 = empty.PushFront(3).PushFront(2);
+        const List v2 = v1.PushFront(1);
+        const List v3 = v1.PushFront(10);
+        assert((values(v1) == std::vector<int>{2, 3}));
+        assert((values(v2) == std::vector<int>{1, 2, 3}));
+        assert((values(v3) == std::vector<int>{10, 2, 3}));
+        assert(v2.GetSize() == 3u && v2.GetFront() == 1);
+        assert(&*std::next(v2.begin()) == &*v1.begin());
+        assert(&*std::next(v3.begin()) == &*v1.begin());
+
+        const List popped = v2.PopFront();
+        assert(popped == v1 && popped.begin() == v1.begin());
+        assert(v2 != v3 && v2 < v3);
+        assert((List{1, 2, 3} == v2));
+    }
+
+    // Снимок — копия за O(1); узлы освобождаются с последней версией
+    {
+        static int alive = 0;
+        struct Tracked {
+            explicit Tracked(int v)
+                : value(v) {
+                ++alive;
+            }
+            Tracked(const Tracked& other)
+                : value(other.value) {
+                ++alive;
+            }
+            ~Tracked() {
+                --alive;
+            }
+            int value;
+        };
+        {
+            PersistentSingleLinkedList<Tracked> lst;
+            lst = lst.EmplaceFront(1).EmplaceFront(2);
+            const auto snapshot = lst;
+            assert(alive == 2 && snapshot.begin() == lst.begin());
+            lst = lst.PopFront().PopFront();
+            assert(lst.IsEmpty() && alive == 2);
+            auto other = snapshot.PopFront();
+            assert(alive == 2 && other.GetFront().value == 1);
+        }
+        assert(alive == 0);
+    }
+
+    // Длинная цепочка освобождается без рекурсии
+    {
+        List lst;
+        for (int i = 0; i < 1'000'000; ++i) {
+            lst = lst.PushFront(i);
+        }
+        assert(lst.GetSize() == 1'000'000u && lst.GetFront() == 999'999);
+    }
+
+    // Читатели обходят свои снимки без блокировок, пока писатель
+    // создаёт новые версии и отпускает старые
+    {
+        List current;
+        for (int i = 0; i < 1000; ++i) {
+            current = current.PushFront(1);
+        }
+        std::vector<List> snapshots(4, current);
+        std::atomic<bool> ok = true;
+        std::vector<std::thread> readers;
+        for (const List& snapshot : snapshots) {
+            readers.emplace_back([&snapshot, &ok] {
+                for (int round = 0; round < 50; ++round) {
+                    if (std::accumulate(snapshot.begin(), snapshot.end(),
+                                        0) != 1000) {
+                        ok = false;
+                    }
+                }
+            });
+        }
+        for (int i = 0; i < 10'000; ++i) {
+            current = current.PopFront().PushFront(2);
+        }
+        for (std::thread& reader : readers) {
+            reader.join();
+        }
+        assert(ok);
+        assert(current.GetFront() == 2 && current.GetSize() == 1000u);
+    }
+}
+
+// Сопрограмма, которая начинает работу сразу и разрушается по
+// завершении. Её возобновляет ChannelList
+struct DetachedCoroutine {
+    struct promise_type {
+        DetachedCoroutine get_return_object() noexcept {
+            return {};
+        }
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+        void return_void() noexcept {
+        }
+        void unhandled_exception() noexcept {
+            std::terminate();
+        }
+    };
+};
+
+DetachedCoroutine ConsumeChannel(ChannelList<int>& channel,
+                                 std::vector<int>& values, bool& done) {
+    while (const std::optional<int> value = co_await channel.PopFrontAsync()) {
+        values.push_back(*value);
+    }
+    done = true;
+}
+
+DetachedCoroutine ConsumeChannelBatches(ChannelList<int>& channel,
+                                        std::vector<int>& values,
+                                        size_t& batches, bool& done) {
+    while (true) {
+        SingleLinkedList<int> batch = co_await channel.PopFrontNAsync(64);
+        if (batch.IsEmpty()) {
+            break;
+        }
+        ++batches;
+        values.insert(values.end(), batch.begin(), batch.end());
+    }
+    done = true;
+}
+
+DetachedCoroutine ProduceChannel(ChannelList<int>& channel, int first,
+                                 int last, bool& done) {
+    for (int i = first; i < last; ++i) {
+        if (!co_await channel.PushBackAsync(i)) {
+            break;
+        }
+    }
+    done = true;
+}
+
+void TestChannelList() {
+    using Values = std::vector<int>;
+    auto values = [](const SingleLinkedList<int>& lst) {
+        return Values(lst.begin(), lst.end());
+    };
+
+    // Пачки, неблокирующие операции и закрытие
+    {
+        ChannelList<int> channel;
+        assert(channel.GetCapacity() == ChannelList<int>::kUnbounded);
+        for (int i = 1; i <= 5; ++i) {
+            assert(channel.PushBack(i));
+        }
+        assert(channel.GetSize() == 5u);
+        assert((values(channel.PopFrontN(3)) == Values{1, 2, 3}));
+        assert((values(channel.TryPopFrontN(10)) == Values{4, 5}));
+        assert(!channel.TryPopFront() && channel.IsEmpty());
+        assert(channel.TryPushBack(6));
+        channel.Close();
+        assert(channel.IsClosed());
+        assert(!channel.PushBack(7) && !channel.TryPushBack(7));
+        assert(channel.PopFront() == 6);
+        assert(!channel.PopFront() && channel.PopFrontN(4).IsEmpty());
+    }
+
+    // Неудачная TryPushBack возвращает перемещённое значение
+    {
+        ChannelList<std::string> channel(1);
+        std::string first = "first";
+        std::string second = "second";
+        assert(channel.TryPushBack(std::move(first)));
+        assert(!channel.TryPushBack(std::move(second)));
+        assert(second == "second");
+        assert(!channel.TryEmplaceBack(3, 'x') && channel.GetSize() == 1u);
+        assert(channel.PopFront() == "first");
+    }
+
+    // Ограниченная очередь: производители ждут места
+    {
+        ChannelList<int> channel(8);
+        assert(channel.TryPushBack(0));
+        assert(channel.PopFront() == 0);
+        const int per_producer = 10'000;
+        std::vector<std::thread> producers;
+        for (int p = 0; p < 2; ++p) {
+            producers.emplace_back([&channel, p] {
+                for (int i = 0; i < per_producer; ++i) {
+                    const bool pushed = channel.PushBack(p * per_producer + i);
+                    assert(pushed);
+                }
+            });
+        }
+        std::atomic<int64_t> sum = 0;
+        std::vector<std::thread> consumers;
+        for (int c = 0; c < 2; ++c) {
+            consumers.emplace_back([&channel, &sum] {
+                int last_seen[2] = {-1, -1};
+                while (true) {
+                    SingleLinkedList<int> batch = channel.PopFrontN(32);
+                    if (batch.IsEmpty()) {
+                        break;
+                    }
+                    assert(batch.GetSize() <= 8u);
+                    for (const int value : batch) {
+                        // Элементы одного производителя идут по порядку
+                        int& last = last_seen[value / per_producer];
+                        assert(value > last);
+                        last = value;
+                        sum += value;
+                    }
+                }
+            });
+        }
+        for (std::thread& producer : producers) {
+            producer.join();
+        }
+        channel.Close();
+        for (std::thread& consumer : consumers) {
+            consumer.join();
+        }
+        const int64_t n = 2 * per_producer;
+        assert(sum == n * (n - 1) / 2);
+    }
+
+    // Сопрограмма-потребитель возобновляется при добавлении элемента
+    {
+        ChannelList<int> channel;
+        Values received;
+        bool done = false;
+        ConsumeChannel(channel, received, done);
+        assert(received.empty());
+        channel.PushBack(1);
+        channel.PushBack(2);
+        assert((received == Values{1, 2}) && channel.IsEmpty());
+        channel.Close();
+        assert(done);
+    }
+
+    // Сопрограмма-производитель ждёт места в ограниченной очереди
+    {
+        ChannelList<int> channel(2);
+        bool done = false;
+        ProduceChannel(channel, 0, 6, done);
+        assert(channel.GetSize() == 2u && !done);
+        assert((values(channel.PopFrontN(10)) == Values{0, 1}));
+        assert((values(channel.PopFrontN(10)) == Values{2, 3}));
+        assert(done);
+        assert((values(channel.PopFrontN(10)) == Values{4, 5}));
+
+        done = false;
+        ProduceChannel(channel, 10, 20, done);
+        channel.Close();
+        assert(done && channel.GetSize() == 2u);
+    }
+
+    // Пачки в сопрограмме, элементы добавляет другой поток
+    {
+        ChannelList<int> channel;
+        Values received;
+        size_t batches = 0;
+        bool done = false;
+        ConsumeChannelBatches(channel, received, batches, done);
+        std::thread producer([&channel] {
+            for (int i = 0; i < 10'000; ++i) {
+                channel.PushBack(i);
+            }
+            channel.Close();
+        });
+        producer.join();
+        assert(done && received.size() == 10'000u);
+        assert(std::is_sorted(received.begin(), received.end()));
+        assert(batches > 0 && batches <= received.size());
+    }
+}
+
+void TestIndexedSingleLinkedList() {
+    using List = IndexedSingleLinkedList<std::string, int>;
+    using Keys = std::vector<std::string>;
+    auto keys = [](const List& lst) {
+        Keys result;
+        for (const auto& [key, value] : lst) {
+            result.push_back(key);
+        }
+        return result;
+    };
+    // Индекс каждого элемента указывает на предыдущий узел
+    auto index_is_consistent = [](const List& lst) {
+        auto prev = lst.before_begin();
+        for (auto it = lst.begin(); it != lst.end(); ++it, ++prev) {
+            if (lst.FindBefore(it->first) != prev ||
+                lst.Find(it->first) != it) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Вставка, поиск и уникальность ключей
+    {
+        List lst{{"b", 2}, {"c", 3}, {"b", 20}};
+        assert((keys(lst) == Keys{"b", "c"}) && lst.GetSize() == 2u);
+        assert(lst.PushFront("a", 1).second);
+        assert(lst.PushBack("e", 5).second);
+        const auto [it, inserted] = lst.InsertAfterKey("c", "d", 4);
+        assert(inserted && it->second == 4);
+        assert((keys(lst) == Keys{"a", "b", "c", "d", "e"}));
+        const auto [existing, again] = lst.PushBack("c", 30);
+        assert(!again && existing->second == 3 && lst.GetSize() == 5u);
+        assert(lst.Contains("d") && !lst.Contains("z"));
+        assert(lst.Find("z") == lst.end() && lst.FindBefore("z") == lst.end());
+        lst.Find("b")->second = 200;
+        assert(std::as_const(lst).Find("b")->second == 200);
+        assert(lst.FindBefore("a") == lst.before_begin());
+        assert(lst.before_end() == lst.Find("e"));
+        assert(index_is_consistent(lst));
+    }
+
+    // Удаление поддерживает индекс соседних элементов
+    {
+        List lst{{"a", 1}, {"b", 2}, {"c", 3}, {"d", 4}};
+        assert(lst.EraseKey("b") && !lst.EraseKey("b"));
+        assert((keys(lst) == Keys{"a", "c", "d"}) && index_is_consistent(lst));
+        lst.PopFront();
+        assert(lst.FindBefore("c") == lst.before_begin());
+        assert(lst.EraseKey("d") && lst.before_end() == lst.Find("c"));
+        lst.EraseAfter(lst.before_begin());
+        assert(lst.IsEmpty() && !lst.Contains("c"));
+        assert(lst.PushBack("x", 1).second && index_is_consistent(lst));
+        lst.Clear();
+        assert(lst.IsEmpty() && !lst.Contains("x"));
+    }
+
+    // Перенос узлов
+    {
+        List lst{{"a", 1}, {"b", 2}, {"c", 3}, {"d", 4}};
+        const auto c = lst.Find("c");
+        assert(lst.MoveToFront("c") == c);
+        assert((keys(lst) == Keys{"c", "a", "b", "d"}));
+        assert(index_is_consistent(lst));
+        lst.MoveToBack("a");
+        assert((keys(lst) == Keys{"c", "b", "d", "a"}));
+        assert(index_is_consistent(lst));
+        lst.MoveToBack("a");
+        lst.MoveToFront("c");
+        assert((keys(lst) == Keys{"c", "b", "d", "a"}));
+        lst.MoveAfter(lst.Find("d"), "b");
+        assert((keys(lst) == Keys{"c", "d", "b", "a"}));
+        assert(index_is_consistent(lst));
+        lst.MoveAfter(lst.Find("a"), "c");
+        assert((keys(lst) == Keys{"d", "b", "a", "c"}));
+        assert(index_is_consistent(lst));
+        assert(lst.MoveToFront("z") == lst.end());
+        assert(lst.Find("c")->second == 3);
+    }
+
+    // Копирование, перемещение и обмен сохраняют индекс
+    {
+        List lst{{"a", 1}, {"b", 2}};
+        List copy(lst);
+        assert(copy == lst && index_is_consistent(copy));
+        List moved(std::move(copy));
+        assert(moved == lst && copy.IsEmpty() && !copy.Contains("a"));
+        assert(index_is_consistent(moved) && index_is_consistent(copy));
+        List other{{"z", 26}};
+        swap(moved, other);
+        assert((keys(moved) == Keys{"z"}) && (keys(other) == Keys{"a", "b"}));
+        assert(index_is_consistent(moved) && index_is_consistent(other));
+        other.PopFront();
+        other = lst;
+        assert(other == lst && index_is_consistent(other));
+        moved = std::move(other);
+        assert(moved == lst && index_is_consistent(moved));
+        moved.EraseKey("a");
+        assert(moved.FindBefore("b") == moved.before_begin());
+    }
+}
+
+void TestListCache() {
+    using Keys = std::vector<int>;
+    auto keys = [](const auto& cache) {
+        Keys result;
+        cache.ForEach([&result](int key, const std::string&) {
+            result.push_back(key);
+        });
+        return result;
+    };
+
+    // LRU: обращение делает запись самой новой
+    {
+        LruCache<int, std::string> cache(3);
+        std::vector<std::pair<int, std::string>> evicted;
+        cache.SetEvictionCallback([&evicted](int key, std::string&& value) {
+            evicted.emplace_back(key, std::move(value));
+        });
+        assert(cache.Put(1, "one") && cache.Put(2, "two"));
+        assert(cache.Put(3, "three"));
+        assert(*cache.Get(1) == "one");
+        assert(!cache.Get(4));
+        cache.Put(4, "four");
+        assert((keys(cache) == Keys{3, 1, 4}));
+        assert(evicted.size() == 1u && evicted[0].first == 2);
+        assert(evicted[0].second == "two");
+
+        assert(!cache.Put(3, "THREE"));
+        assert((keys(cache) == Keys{1, 4, 3}) && *cache.Peek(3) == "THREE");
+        assert(cache.Touch(1) && !cache.Touch(7));
+        assert((keys(cache) == Keys{4, 3, 1}));
+        assert(*cache.Peek(4) == "four" && (keys(cache) == Keys{4, 3, 1}));
+
+        assert(cache.EvictOldest() && evicted.back().first == 4);
+        assert(cache.Erase(3) && !cache.Erase(3));
+        assert(evicted.size() == 2u && cache.GetSize() == 1u);
+
+        const CacheStats& stats = cache.GetStats();
+        assert(stats.hits == 1 && stats.misses == 1 && stats.evictions == 2);
+        cache.ResetStats();
+        assert(cache.GetStats().hits == 0);
+        cache.Clear();
+        assert(cache.IsEmpty() && cache.GetBytes() == 0u);
+    }
+
+    // FIFO: обращение не меняет порядок вытеснения
+    {
+        FifoCache<int, std::string> cache(2);
+        cache.Put(1, "one");
+        cache.Put(2, "two");
+        assert(cache.Get(1) && !cache.Put(1, "uno"));
+        cache.Put(3, "three");
+        assert((keys(cache) == Keys{2, 3}) && !cache.Contains(1));
+        assert(cache.GetStats().evictions == 1);
+    }
+
+    // Ограничение по размеру записей
+    {
+        struct StringWeigher {
+            size_t operator()(int, const std::string& value) const {
+                return value.size();
+            }
+        };
+        LruCache<int, std::string, std::hash<int>, StringWeigher> cache(
+            100, 10);
+        assert(cache.GetMaxBytes() == 10u);
+        cache.Put(1, "aaaa");
+        cache.Put(2, "bbbb");
+        assert(cache.GetBytes() == 8u);
+        cache.Put(3, "cc");
+        assert(cache.GetBytes() == 10u && cache.GetSize() == 3u);
+        cache.Put(2, "b");
+        assert(cache.GetBytes() == 7u);
+        cache.Put(4, "dddd");
+        assert((keys(cache) == Keys{3, 2, 4}) && cache.GetBytes() == 7u);
+        // Запись больше ограничения вытесняется сразу
+        cache.Put(5, std::string(11, 'e'));
+        assert(cache.IsEmpty() && cache.GetBytes() == 0u);
+    }
+}
+
+void TestSortedSingleLinkedList() {
+    using Values = std::vector<int>;
+    auto values = [](const auto& range) {
+        return Values(std::begin(range), std::end(range));
+    };
+
+    // Вставка сохраняет порядок, равные элементы идут по порядку
+    // вставки
+    {
+        SortedSingleLinkedList<int> lst;
+        assert(lst.IsEmpty() && lst.LowerBound(1) == lst.end());
+        for (const int value : {5, 1, 4, 1, 3}) {
+            assert(*lst.Insert(value) == value);
+        }
+        assert((values(lst) == Values{1, 1, 3, 4, 5}) && lst.GetSize() == 5u);
+        assert(lst.Find(1) == lst.begin());
+        assert(lst.Find(2) == lst.end() && !lst.Contains(2));
+        assert(*lst.LowerBound(2) == 3 && *lst.UpperBound(3) == 4);
+        assert(lst.LowerBound(6) == lst.end());
+
+        using Pair = std::pair<int, int>;
+        struct ByFirst {
+            bool operator()(const Pair& lhs, const Pair& rhs) const {
+                return lhs.first < rhs.first;
+            }
+        };
+        SortedSingleLinkedList<Pair, ByFirst> stable;
+        for (int i = 0; i < 4; ++i) {
+            stable.Insert({i % 2, i});
+        }
+        assert((std::vector<Pair>(stable.begin(), stable.end()) ==
+                std::vector<Pair>{{0, 0}, {0, 2}, {1, 1}, {1, 3}}));
+        assert(stable.Erase({1, -1}) && stable.begin()->second == 0);
+        assert(std::next(stable.begin(), 2)->second == 3);
+    }
+
+    // Insert создаёт элемент сразу в цепочке: других объектов Type,
+    // кроме самого элемента, не появляется. Emplace создаёт значение
+    // один раз и перемещает его в узел
+    {
+        static int constructions = 0;
+        struct Counted {
+            Counted() {
+                ++constructions;
+            }
+            explicit Counted(int k)
+                : key(k) {
+                ++constructions;
+            }
+            Counted(const Counted& other)
+                : key(other.key) {
+                ++constructions;
+            }
+            Counted(Counted&& other) noexcept
+                : key(other.key) {
+                ++constructions;
+            }
+            bool operator<(const Counted& rhs) const {
+                return key < rhs.key;
+            }
+            int key = 0;
+        };
+        SortedSingleLinkedList<Counted> lst;
+        const Counted two(2);
+        constructions = 0;
+        assert(lst.Insert(two)->key == 2 && constructions == 1);
+        Counted one(1);
+        constructions = 0;
+        assert(lst.Insert(std::move(one))->key == 1 && constructions == 1);
+        constructions = 0;
+        assert(lst.Emplace(3)->key == 3 && constructions == 2);
+        assert(lst.begin()->key == 1 && std::next(lst.begin(), 2)->key == 3);
+    }
+
+    // Совпадение с std::multiset на случайных операциях
+    {
+        SortedSingleLinkedList<int> lst;
+        std::multiset<int> expected;
+        std::mt19937 generator(7);
+        std::uniform_int_distribution<int> value(0, 999);
+        for (int i = 0; i < 20'000; ++i) {
+            const int v = value(generator);
+            if (generator() % 3 == 0) {
+                const auto it = expected.find(v);
+                assert(lst.Erase(v) == (it != expected.end()));
+                if (it != expected.end()) {
+                    expected.erase(it);
+                }
+            } else {
+                lst.Insert(v);
+                expected.insert(v);
+            }
+        }
+        assert(lst.GetSize() == expected.size());
+        assert(std::equal(lst.begin(), lst.end(), expected.begin(),
+                          expected.end()));
+        for (int v = 0; v < 1000; v += 37) {
+            assert(lst.Contains(v) == (expected.count(v) > 0));
+        }
+        while (!lst.IsEmpty()) {
+            assert(*lst.begin() == *expected.begin());
+            lst.PopFront();
+            expected.erase(expected.begin());
+        }
+        lst.Insert(1);
+        assert((values(lst) == Values{1}));
+    }
+
+    // Диапазоны
+    {
+        const SortedSingleLinkedList<int> lst{9, 1, 7, 3, 5};
+        assert((values(lst.GetRange(3, 8)) == Values{3, 5, 7}));
+        assert((values(lst.GetRange(0, 100)) == Values{1, 3, 5, 7, 9}));
+        assert(lst.GetRange(4, 5).empty() && lst.GetRange(8, 2).empty());
+        int sum = 0;
+        for (const int v : lst.GetRange(2, 9)) {
+            sum += v;
+        }
+        assert(sum == 15);
+    }
+
+    // Копирование, перемещение, обмен и очистка
+    {
+        SortedSingleLinkedList<int> lst{3, 1, 2};
+        SortedSingleLinkedList<int> copy(lst);
+        copy.Insert(0);
+        assert((values(copy) == Values{0, 1, 2, 3}));
+        assert((values(lst) == Values{1, 2, 3}));
+        SortedSingleLinkedList<int> moved(std::move(copy));
+        assert(copy.IsEmpty() && moved.Contains(0));
+        copy.Insert(5);
+        assert((values(copy) == Values{5}));
+        swap(moved, lst);
+        assert(lst.Erase(0) && (values(lst) == Values{1, 2, 3}));
+        assert(moved.Find(2) != moved.end());
+        lst = moved;
+        assert(lst == moved);
+        lst.Clear();
+        assert(lst.IsEmpty() && !lst.Contains(1));
+        lst.Insert(4);
+        assert((values(lst) == Values{4}));
+    }
+}
+
+void TestCompactSingleLinkedList() {
+    using List = CompactSingleLinkedList<int32_t>;
+    auto values = [](const auto& lst) {
+        return std::vector<int32_t>(lst.begin(), lst.end());
+    };
+
+    // Операции повторяют SingleLinkedList, а узлы лежат в пуле
+    {
+        List lst;
+        assert(lst.IsEmpty() && lst.begin() == lst.end());
+        assert(lst.GetCapacity() == 0u && lst.GetBytesPerElement() == 0.0);
+        assert(lst.before_end() == lst.before_begin());
+        lst.PushBack(2);
+        lst.PushFront(1);
+        lst.PushBack(4);
+        auto it = lst.InsertAfter(std::next(lst.cbegin()), 3);
+        assert(*it == 3 && *lst.before_end() == 4);
+        assert((values(lst) == std::vector<int32_t>{1, 2, 3, 4}));
+        assert(lst.Contains(3) && !lst.Contains(5));
+        assert(lst.Find(5) == lst.end() && *lst.Find(2) == 2);
+
+        // Удалённый узел используется следующей вставкой, а
+        // итераторы на другие элементы остаются действительными
+        const size_t capacity = lst.GetCapacity();
+        auto four = std::next(lst.begin(), 3);
+        assert(*lst.EraseAfter(lst.cbegin()) == 3);
+        lst.EmplaceFront(0);
+        assert(lst.GetCapacity() == capacity && *four == 4);
+        assert((values(lst) == std::vector<int32_t>{0, 1, 3, 4}));
+
+        lst.EraseAfter(std::next(lst.cbegin(), 2));
+        assert(*lst.before_end() == 3);
+        lst.EmplaceBack(5);
+        lst.PopFront();
+        assert((values(lst) == std::vector<int32_t>{1, 3, 5}));
+        lst.Clear();
+        assert(lst.IsEmpty() && lst.GetCapacity() == 0u);
+        lst.PushBack(7);
+        assert(lst.GetSize() == 1u && *lst.begin() == 7);
+    }
+
+    // Пул растёт кусками, не перемещая уже созданные узлы, и на
+    // элемент int32_t уходит меньше памяти, чем узел SingleLinkedList
+    {
+        List lst;
+        lst.Reserve(100);
+        assert(lst.GetCapacity() >= 100u);
+        const int32_t* first = &lst.EmplaceBack(0);
+        for (int32_t i = 1; i < 100'000; ++i) {
+            lst.PushBack(i);
+        }
+        assert(*first == 0 && &*lst.begin() == first);
+        int64_t sum = 0;
+        for (const int32_t value : lst) {
+            sum += value;
+        }
+        assert(sum == int64_t{99'999} * 100'000 / 2);
+        assert(lst.GetBytesPerElement() < 16.0);
+
+        const List copy = lst;
+        assert(copy == lst && copy.GetCapacity() <= lst.GetCapacity());
+        List moved(std::move(lst));
+        assert(lst.IsEmpty() && lst.GetCapacity() == 0u);
+        assert(moved.GetSize() == 100'000u && &*moved.begin() == first);
+        moved.PushFront(-1);
+        assert(moved != copy && moved < copy);
+
+        List other{9};
+        swap(other, moved);
+        assert(other.GetSize() == 100'001u);
+        assert((values(moved) == std::vector<int32_t>{9}));
+        other = moved;
+        assert(other == moved && other.GetCapacity() < 100u);
+        other = std::move(moved);
+        assert(moved.IsEmpty() && (values(other) == std::vector<int32_t>{9}));
+    }
+
+    // Итераторы на элементы ссылаются на пул, а не на объект списка,
+    // поэтому переживают обмен и перемещение
+    {
+        List a{1, 2, 3};
+        List b{10, 20};
+        auto two = std::next(a.begin());
+        auto twenty = std::next(b.cbegin());
+        a.swap(b);
+        assert(*two == 2 && *twenty == 20);
+        assert(*++two == 3 && ++two == b.end());
+        two = std::next(b.begin());
+
+        List moved(std::move(b));
+        assert(*two == 2 && std::next(two) == moved.before_end());
+        List assigned;
+        assigned = std::move(moved);
+        assert(*two == 2 && *twenty == 20 && *a.begin() == 10);
+        assigned.EraseAfter(two);
+        assert((values(assigned) == std::vector<int32_t>{1, 2}));
+        assert(*assigned.before_end() == 2);
+
+        // before_begin() пустого списка остаётся рабочим после
+        // первой вставки
+        List empty;
+        auto head = empty.before_begin();
+        empty.PushBack(5);
+        assert(*++head == 5);
+    }
+
+    // Аллокатор переходит при присваивании и обмене, как требуют его
+    // признаки propagate_on_container_*
+    {
+        using PooledList = CompactSingleLinkedList<int, PoolAllocator<int>>;
+        PoolAllocator<int> first_pool;
+        PoolAllocator<int> second_pool;
+        PooledList lst({1, 2}, first_pool);
+        PooledList other({3}, second_pool);
+        lst = other;
+        assert(lst.get_allocator() == second_pool && lst == other);
+        PooledList moved({4}, first_pool);
+        lst = std::move(moved);
+        assert(lst.get_allocator() == first_pool && *lst.begin() == 4);
+        swap(lst, other);
+        assert(lst.get_allocator() == second_pool && *lst.begin() == 3);
+        assert(other.get_allocator() == first_pool && *other.begin() == 4);
+    }
+
+    // Элементы разрушаются ровно один раз, а исключение при создании
+    // элемента оставляет список в прежнем состоянии
+    {
+        static int alive = 0;
+        struct Tracked {
+            explicit Tracked(int v, bool fail = false)
+                : value(v) {
+                if (fail) {
+                    throw std::runtime_error("construction failed");
+                }
+                ++alive;
+            }
+            Tracked(const Tracked& other)
+                : value(other.value) {
+                ++alive;
+            }
+            ~Tracked() {
+                --alive;
+            }
+            int value;
+        };
+        {
+            CompactSingleLinkedList<Tracked> lst;
+            lst.EmplaceBack(1);
+            bool thrown = false;
+            try {
+                lst.EmplaceBack(2, true);
+            } catch (const std::runtime_error&) {
+                thrown = true;
+            }
+            assert(thrown && lst.GetSize() == 1u && alive == 1);
+            for (int i = 2; i <= 40; ++i) {
+                lst.EmplaceBack(i);
+            }
+            lst.EraseAfter(lst.cbegin());
+            assert(alive == 39 && std::next(lst.begin())->value == 3);
+            CompactSingleLinkedList<Tracked> copy(lst);
+            assert(alive == 78);
+        }
+        assert(alive == 0);
+    }
+}
+
+void TestTraversalModes() {
+    using List = SingleLinkedList<int>;
+
+    // Обход с предвыборкой выдаёт элементы в прежнем порядке при любом
+    // расстоянии, в том числе большем длины списка
+    {
+        for (const size_t size : {0u, 1u, 3u, 8u, 1000u}) {
+            List lst;
+            std::vector<int> expected;
+            for (size_t i = 0; i < size; ++i) {
+                lst.PushBack(static_cast<int>(i));
+                expected.push_back(static_cast<int>(i));
+            }
+            for (const size_t distance :
+                 {size_t{1}, size_t{7}, List::kDefaultPrefetchDistance,
+                  List::kMaxPrefetchDistance}) {
+                std::vector<int> visited;
+                const List& const_lst = lst;
+                const_lst.ForEachPrefetched(
+                    [&visited](const int value) {
+                        visited.push_back(value);
+                    },
+                    distance);
+                assert(visited == expected);
+            }
+        }
+
+        List lst{1, 2, 3, 4, 5};
+        lst.ForEachPrefetched([](int& value) {
+            value *= 10;
+        }, 2);
+        assert((lst == List{10, 20, 30, 40, 50}));
+
+        // Адрес данных вне узла запрашивается для каждого элемента
+        // по порядку и заранее: к вызову func для элемента i уже
+        // запрошены адреса элементов до i + distance
+        const std::vector<int> table{100, 101, 102, 103, 104, 105, 106};
+        List keys{6, 0, 5, 1, 4, 2, 3};
+        std::vector<int> requested;
+        std::vector<int> looked_up;
+        const size_t distance = 3;
+        std::as_const(keys).ForEachPrefetched(
+            [&](const int key) {
+                const size_t position = looked_up.size();
+                assert(requested.size() >=
+                       std::min(position + distance, keys.GetSize()));
+                looked_up.push_back(table[key]);
+            },
+            [&](const int key) -> const void* {
+                requested.push_back(key);
+                return &table[key];
+            },
+            distance);
+        assert(requested == std::vector<int>(keys.begin(), keys.end()));
+        assert((looked_up ==
+                std::vector<int>{106, 100, 105, 101, 104, 102, 103}));
+    }
+
+    // Пакеты покрывают список по порядку, все, кроме последнего,
+    // полного размера
+    {
+        List lst;
+        for (int i = 0; i < 1000; ++i) {
+            lst.PushBack(i);
+        }
+        for (const size_t batch :
+             {size_t{1}, size_t{7}, List::kDefaultTraversalBatch,
+              List::kMaxTraversalBatch}) {
+            std::vector<int> visited;
+            size_t batches = 0;
+            std::as_const(lst).ForEachBatch(
+                [&](std::span<const int* const> values) {
+                    assert(!values.empty() && values.size() <= batch);
+                    assert(visited.size() % batch == 0);
+                    for (const int* value : values) {
+                        visited.push_back(*value);
+                    }
+                    ++batches;
+                },
+                batch);
+            assert(visited == std::vector<int>(lst.begin(), lst.end()));
+            assert(batches == (1000 + batch - 1) / batch);
+        }
+
+        lst.ForEachBatch([](std::span<int* const> values) {
+            for (int* value : values) {
+                *value = -*value;
+            }
+        });
+        assert(lst.Sum() == -999 * 1000 / 2);
+
+        List empty;
+        empty.ForEachBatch([](std::span<int* const>) {
+            assert(false);
+        });
+    }
+
+    // Оба обхода учитываются в статистике как обход по итераторам
+    {
+        SingleLinkedList<int, std::allocator<int>, CountingListStats> lst{
+            1, 2, 3, 4};
+        const ListStats before = lst.GetStats();
+        lst.ForEachPrefetched([](int) {});
+        lst.ForEachBatch([](std::span<int* const>) {}, 3);
+        const ListStats after = lst.GetStats();
+        assert(after.traversals - before.traversals == 2u);
+        assert(after.traversal_steps - before.traversal_steps == 8u);
+    }
 }
 
 int main() {
     Test();
+    TestNodePool();
+    TestMoveSemantics();
+    TestSplice();
+    TestUnrolledSingleLinkedList();
+    TestConcurrentSingleLinkedList();
+    TestRelinkingAlgorithms();
+    TestRangeInsertion();
+    TestNodeRecycling();
+    TestListStats();
+    TestSerialization();
+    TestIntrusiveSingleLinkedList();
+    TestSearchKernels();
+    TestParallelAlgorithms();
+    TestSmallSingleLinkedList();
+    TestConstexprLists();
+    TestRanges();
+    TestPersistentSingleLinkedList();
+    TestChannelList();
+    TestIndexedSingleLinkedList();
+    TestListCache();
+    TestSortedSingleLinkedList();
+    TestCompactSingleLinkedList();
+    TestTraversalModes();
 }
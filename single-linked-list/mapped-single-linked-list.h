@@ -0,0 +1,215 @@
+#pragma once
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "serialized-list-format.h"
+#include "simd-kernels.h"
+
+/*
+ * Представление снимка, записанного SingleLinkedList::Serialize,
+ * только для чтения.
+ * Файл отображается в память целиком, элементы читаются прямо из
+ * отображения: открытие не копирует данные и не выделяет память под
+ * узлы, а страницы файла подгружаются при первом обращении.
+ * Предоставляет тот же интерфейс чтения, что и SingleLinkedList:
+ * ConstIterator, begin/end, cbegin/cend, GetSize, IsEmpty.
+ * Элементы в снимке лежат подряд, поэтому ConstIterator — указатель.
+ * Файл не должен изменяться, пока представление существует
+ */
+template <typename Type>
+class MappedSingleLinkedList {
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "MappedSingleLinkedList requires a trivially copyable "
+                  "Type");
+
+public:
+    using value_type = Type;
+    using const_reference = const value_type&;
+    using ConstIterator = const Type*;
+
+    MappedSingleLinkedList() = default;
+
+    /*
+     * Отображает в память файл path.
+     * Выбрасывает std::system_error, если файл не удалось открыть или
+     * отобразить, и std::runtime_error, если он не является снимком
+     * списка элементов Type
+     */
+    explicit MappedSingleLinkedList(const std::string& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(),
+                                    "open " + path);
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(),
+                                    "fstat " + path);
+        }
+        mapping_size_ = static_cast<size_t>(st.st_size);
+        if (mapping_size_ < sizeof(SerializedListHeader)) {
+            ::close(fd);
+            throw std::runtime_error("truncated serialized list");
+        }
+        void* mapping = ::mmap(nullptr, mapping_size_, PROT_READ,
+                               MAP_PRIVATE, fd, 0);
+        // Отображение остаётся действительным после закрытия файла
+        const int error = errno;
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            mapping_size_ = 0;
+            throw std::system_error(error, std::generic_category(),
+                                    "mmap " + path);
+        }
+        mapping_ = mapping;
+        try {
+            Attach();
+        } catch (...) {
+            Unmap();
+            throw;
+        }
+    }
+
+    MappedSingleLinkedList(const MappedSingleLinkedList&) = delete;
+    MappedSingleLinkedList& operator=(const MappedSingleLinkedList&) =
+        delete;
+
+    MappedSingleLinkedList(MappedSingleLinkedList&& other) noexcept
+        : mapping_(std::exchange(other.mapping_, nullptr))
+        , mapping_size_(std::exchange(other.mapping_size_, 0))
+        , data_(std::exchange(other.data_, nullptr))
+        , size_(std::exchange(other.size_, 0)) {
+    }
+
+    MappedSingleLinkedList& operator=(
+        MappedSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            Unmap();
+            mapping_ = std::exchange(rhs.mapping_, nullptr);
+            mapping_size_ = std::exchange(rhs.mapping_size_, 0);
+            data_ = std::exchange(rhs.data_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+        }
+        return *this;
+    }
+
+    ~MappedSingleLinkedList() {
+        Unmap();
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return data_;
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return data_ + size_;
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    // Возвращает количество элементов за время O(1)
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Поиск и агрегаты выполняются ядрами SimdKernels над всем
+    // снимком сразу, так как его элементы лежат подряд
+
+    // Возвращает итератор на первый элемент, равный value, либо end()
+    [[nodiscard]] ConstIterator Find(const Type& value) const {
+        return data_ + SimdKernels::Find(data_, size_, value);
+    }
+
+    // Возвращает количество элементов, равных value
+    [[nodiscard]] size_t Count(const Type& value) const {
+        return SimdKernels::Count(data_, size_, value);
+    }
+
+    // Сообщает, есть ли в снимке элемент, равный value
+    [[nodiscard]] bool Contains(const Type& value) const {
+        return Find(value) != end();
+    }
+
+    // Возвращает сумму элементов, начиная с init. Для чисел с
+    // плавающей точкой порядок сложения не определён
+    [[nodiscard]] Type Sum(Type init = Type()) const {
+        return SimdKernels::Sum(data_, size_, init);
+    }
+
+    // Возвращает наименьший и наибольший элементы непустого снимка
+    [[nodiscard]] std::pair<Type, Type> MinMax() const {
+        assert(!IsEmpty());
+        return SimdKernels::MinMax(data_, size_);
+    }
+
+private:
+    // Проверяет заголовок отображённого снимка и находит элементы
+    void Attach() {
+        const auto* bytes = static_cast<const std::byte*>(mapping_);
+        SerializedListHeader header;
+        std::memcpy(&header, bytes, sizeof(header));
+        CheckSerializedListHeader<Type>(header);
+        constexpr size_t kOffset = SerializedListDataOffset<Type>();
+        if (mapping_size_ < kOffset ||
+            header.count > (mapping_size_ - kOffset) / sizeof(Type)) {
+            throw std::runtime_error("truncated serialized list");
+        }
+        size_ = static_cast<size_t>(header.count);
+        data_ = std::launder(reinterpret_cast<const Type*>(bytes + kOffset));
+    }
+
+    void Unmap() noexcept {
+        if (mapping_ != nullptr) {
+            ::munmap(mapping_, mapping_size_);
+            mapping_ = nullptr;
+            mapping_size_ = 0;
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    void* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    const Type* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+template <typename Type>
+bool operator==(const MappedSingleLinkedList<Type>& lhs,
+                const MappedSingleLinkedList<Type>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() &&
+           SimdKernels::Equal(lhs.begin(), rhs.begin(), lhs.GetSize());
+}
+
+template <typename Type>
+bool operator!=(const MappedSingleLinkedList<Type>& lhs,
+                const MappedSingleLinkedList<Type>& rhs) {
+    return !(lhs == rhs);
+}
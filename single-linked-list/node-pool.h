@@ -0,0 +1,210 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Пул блоков фиксированного размера.
+ * Память запрашивается у системы крупными кусками (chunk), из
+ * которых подряд нарезаются блоки. Освобождённые блоки попадают в
+ * список свободных и выдаются повторно раньше, чем нарезаются
+ * новые. Память кусков возвращается системе только при разрушении
+ * пула.
+ * Размер блока фиксируется при первом выделении. Пул не
+ * потокобезопасен
+ */
+class NodePool {
+public:
+    // Количество блоков в одном куске по умолчанию
+    static constexpr size_t kDefaultBlocksPerChunk = 256;
+
+    explicit NodePool(size_t blocks_per_chunk = kDefaultBlocksPerChunk)
+        : blocks_per_chunk_(blocks_per_chunk) {
+        assert(blocks_per_chunk_ > 0);
+    }
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    ~NodePool() {
+        for (std::byte* chunk : chunks_) {
+            ::operator delete(chunk, std::align_val_t{alignment_});
+        }
+    }
+
+    // Сообщает, может ли пул выдавать блоки размером size с
+    // выравниванием alignment. Пустой пул принимает любой размер,
+    // после первого выделения — только совпадающий
+    [[nodiscard]] bool Accepts(size_t size, size_t alignment) const
+        noexcept {
+        if (block_size_ == 0) {
+            return true;
+        }
+        return BlockSizeFor(size, alignment) == block_size_ &&
+               alignment <= alignment_;
+    }
+
+    // Выдаёт блок размером size с выравниванием alignment
+    // Если свободных блоков нет, выделяет новый кусок памяти
+    [[nodiscard]] void* Allocate(size_t size, size_t alignment) {
+        assert(Accepts(size, alignment));
+        if (block_size_ == 0) {
+            alignment_ = std::max(alignment, alignof(FreeBlock));
+            block_size_ = BlockSizeFor(size, alignment);
+        }
+        if (free_list_ != nullptr) {
+            FreeBlock* block = free_list_;
+            free_list_ = block->next;
+            --free_count_;
+            return block;
+        }
+        if (chunk_cursor_ == chunk_end_) {
+            AddChunk();
+        }
+        void* block = chunk_cursor_;
+        chunk_cursor_ += block_size_;
+        return block;
+    }
+
+    // Возвращает блок в список свободных за время O(1)
+    void Deallocate(void* ptr) noexcept {
+        assert(ptr != nullptr);
+        free_list_ = ::new (ptr) FreeBlock{free_list_};
+        ++free_count_;
+    }
+
+    // Размер блока в байтах либо 0, если пул ещё не использовался
+    [[nodiscard]] size_t GetBlockSize() const noexcept {
+        return block_size_;
+    }
+
+    // Количество кусков памяти, выделенных пулом
+    [[nodiscard]] size_t GetChunkCount() const noexcept {
+        return chunks_.size();
+    }
+
+    // Количество блоков в списке свободных
+    [[nodiscard]] size_t GetFreeBlockCount() const noexcept {
+        return free_count_;
+    }
+
+private:
+    // Свободный блок хранит указатель на следующий свободный блок
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    // Размер блока, в котором помещается объект размером size
+    // либо FreeBlock, кратный выравниванию
+    static size_t BlockSizeFor(size_t size, size_t alignment) noexcept {
+        const size_t block_alignment =
+            std::max(alignment, alignof(FreeBlock));
+        const size_t block_size = std::max(size, sizeof(FreeBlock));
+        return (block_size + block_alignment - 1) / block_alignment *
+               block_alignment;
+    }
+
+    void AddChunk() {
+        const size_t chunk_size = block_size_ * blocks_per_chunk_;
+        chunks_.reserve(chunks_.size() + 1);
+        auto* chunk = static_cast<std::byte*>(
+            ::operator new(chunk_size, std::align_val_t{alignment_}));
+        chunks_.push_back(chunk);
+        chunk_cursor_ = chunk;
+        chunk_end_ = chunk + chunk_size;
+    }
+
+    size_t blocks_per_chunk_;
+    size_t block_size_ = 0;
+    size_t alignment_ = alignof(FreeBlock);
+    std::vector<std::byte*> chunks_;
+    std::byte* chunk_cursor_ = nullptr;
+    std::byte* chunk_end_ = nullptr;
+    FreeBlock* free_list_ = nullptr;
+    size_t free_count_ = 0;
+};
+
+/*
+ * Аллокатор, выдающий одиночные объекты из общего NodePool.
+ * Предназначен для узлов SingleLinkedList: список перепривязывает
+ * его к своему типу Node, и все узлы берутся из одного пула.
+ * Копии аллокатора (в том числе перепривязанные) разделяют пул.
+ * Запросы на несколько объектов и объекты, размер которых не
+ * совпадает с размером блока пула, обслуживаются operator new
+ */
+template <typename T>
+class PoolAllocator {
+    template <typename U>
+    friend class PoolAllocator;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    // Создаёт аллокатор с собственным пулом
+    PoolAllocator()
+        : pool_(std::make_shared<NodePool>()) {
+    }
+
+    // Создаёт аллокатор, использующий пул pool
+    explicit PoolAllocator(std::shared_ptr<NodePool> pool) noexcept
+        : pool_(std::move(pool)) {
+        assert(pool_ != nullptr);
+    }
+
+    // Копирование и перемещение аллокатора разделяют пул: после
+    // перемещения исходный аллокатор остаётся работоспособным,
+    // как того требуют контейнеры
+    PoolAllocator(const PoolAllocator&) noexcept = default;
+    PoolAllocator& operator=(const PoolAllocator&) noexcept = default;
+
+    // Конвертирующий конструктор для перепривязки. Разделяет пул
+    // с other
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept
+        : pool_(other.pool_) {
+    }
+
+    [[nodiscard]] T* allocate(size_t n) {
+        if (n == 1 && pool_->Accepts(sizeof(T), alignof(T))) {
+            return static_cast<T*>(
+                pool_->Allocate(sizeof(T), alignof(T)));
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        if (n == 1 && pool_->Accepts(sizeof(T), alignof(T))) {
+            pool_->Deallocate(ptr);
+        } else {
+            std::allocator<T>().deallocate(ptr, n);
+        }
+    }
+
+    // Возвращает пул, из которого выделяются объекты
+    [[nodiscard]] const std::shared_ptr<NodePool>& GetPool() const
+        noexcept {
+        return pool_;
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& rhs) const noexcept {
+        return pool_ == rhs.pool_;
+    }
+
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>& rhs) const noexcept {
+        return pool_ != rhs.pool_;
+    }
+
+private:
+    std::shared_ptr<NodePool> pool_;
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "work-stealing-pool.h"
+
+/*
+ * Параллельные обходы односвязного списка.
+ * Список нельзя разделить на части без последовательного прохода,
+ * поэтому алгоритмы работают по индексу участков, построенному
+ * методом BuildChunkIndex. Каждый участок — отдельная задача пула
+ * WorkStealingPool. Индекс должен быть действительным для списка
+ * (ChunkIndex::IsValidFor), а список не должен изменяться во время
+ * обхода. Размер участка выбирается так, чтобы задач было в
+ * несколько раз больше, чем потоков: тогда перехват задач
+ * выравнивает нагрузку
+ */
+
+// Размер участка по умолчанию для BuildChunkIndex
+inline constexpr size_t kDefaultParallelChunkSize = 16 * 1024;
+
+// Вызывает func для каждого элемента list. Вызовы для разных
+// элементов выполняются одновременно из разных потоков
+template <typename List, typename Func>
+void ParallelForEach(List& list,
+                     const typename std::remove_const_t<List>::ChunkIndex&
+                         index,
+                     Func func,
+                     WorkStealingPool& pool = WorkStealingPool::Default()) {
+    assert(index.IsValidFor(list));
+    pool.ParallelFor(index.GetChunkCount(), [&](size_t chunk) {
+        auto [first, last] = list.GetChunk(index, chunk);
+        for (; first != last; ++first) {
+            func(*first);
+        }
+    });
+}
+
+/*
+ * Сворачивает элементы list операцией op, начиная с init.
+ * Свёртка участка начинается с его первого элемента, приведённого к
+ * T. Участки сворачиваются параллельно, а их результаты — по порядку
+ * участков, поэтому op должна быть ассоциативной, но может быть
+ * некоммутативной
+ */
+template <typename List, typename T, typename BinaryOp>
+T ParallelReduce(const List& list, const typename List::ChunkIndex& index,
+                 T init, BinaryOp op,
+                 WorkStealingPool& pool = WorkStealingPool::Default()) {
+    assert(index.IsValidFor(list));
+    std::vector<std::optional<T>> partials(index.GetChunkCount());
+    pool.ParallelFor(index.GetChunkCount(), [&](size_t chunk) {
+        auto [first, last] = list.GetChunk(index, chunk);
+        // Участки индекса не бывают пустыми
+        T partial(*first);
+        partials[chunk] =
+            std::accumulate(++first, last, std::move(partial), op);
+    });
+    for (std::optional<T>& partial : partials) {
+        init = op(std::move(init), std::move(*partial));
+    }
+    return init;
+}
+
+// Возвращает количество элементов list, для которых pred истинно
+template <typename List, typename Predicate>
+size_t ParallelCount(const List& list,
+                     const typename List::ChunkIndex& index, Predicate pred,
+                     WorkStealingPool& pool = WorkStealingPool::Default()) {
+    assert(index.IsValidFor(list));
+    std::vector<size_t> counts(index.GetChunkCount());
+    pool.ParallelFor(index.GetChunkCount(), [&](size_t chunk) {
+        auto [first, last] = list.GetChunk(index, chunk);
+        size_t count = 0;
+        for (; first != last; ++first) {
+            count += static_cast<bool>(pred(*first));
+        }
+        counts[chunk] = count;
+    });
+    return std::accumulate(counts.begin(), counts.end(), size_t{0});
+}
@@ -0,0 +1,275 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+/*
+ * Неизменяемый односвязный список со структурным разделением.
+ * PushFront и PopFront не меняют список, а возвращают новую версию,
+ * которая разделяет хвост с исходной. Узлы неизменяемы и освобождаются
+ * по счётчику ссылок, когда их не использует ни одна версия, поэтому
+ * копия версии (снимок) создаётся за время O(1).
+ * Версии можно передавать между потоками: счётчики ссылок атомарны,
+ * а неизменяемые узлы обходятся без блокировок. Как и для
+ * std::shared_ptr, один объект версии нельзя одновременно
+ * перезаписывать и читать из разных потоков без синхронизации
+ */
+template <typename Type>
+class PersistentSingleLinkedList {
+    struct Node {
+        template <typename... Args>
+        explicit Node(Node* next, Args&&... args)
+            : value(std::forward<Args>(args)...)
+            , next_node(next) {
+        }
+        const Type value;
+        // Узел владеет ссылкой на следующий узел
+        Node* const next_node;
+        std::atomic<size_t> ref_count{1};
+    };
+
+public:
+    // Итератор только для чтения: элементы версий неизменяемы
+    class ConstIterator {
+        friend class PersistentSingleLinkedList;
+
+        explicit ConstIterator(const Node* node) noexcept
+            : node_(node) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        ConstIterator() = default;
+
+        [[nodiscard]] bool operator==(const ConstIterator& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
+
+        [[nodiscard]] bool operator!=(const ConstIterator& rhs) const noexcept {
+            return node_ != rhs.node_;
+        }
+
+        ConstIterator& operator++() noexcept {
+            assert(node_ != nullptr);
+            node_ = node_->next_node;
+            return *this;
+        }
+
+        ConstIterator operator++(int) noexcept {
+            auto old_value(*this);
+            ++(*this);
+            return old_value;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(node_ != nullptr);
+            return node_->value;
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            return &**this;
+        }
+
+    private:
+        const Node* node_ = nullptr;
+    };
+
+    using value_type = Type;
+    using reference = const value_type&;
+    using const_reference = const value_type&;
+    using Iterator = ConstIterator;
+
+    PersistentSingleLinkedList() = default;
+
+    PersistentSingleLinkedList(std::initializer_list<Type> values) {
+        // Список строится с конца, чтобы каждый узел создавался
+        // сразу со ссылкой на следующий
+        try {
+            for (auto it = std::rbegin(values); it != std::rend(values);
+                 ++it) {
+                head_ = new Node(head_, *it);
+                ++size_;
+            }
+        } catch (...) {
+            Release(head_);
+            throw;
+        }
+    }
+
+    // Снимок версии за время O(1): узлы разделяются, а не копируются
+    PersistentSingleLinkedList(const PersistentSingleLinkedList& other) noexcept
+        : head_(AddRef(other.head_))
+        , size_(other.size_) {
+    }
+
+    PersistentSingleLinkedList(PersistentSingleLinkedList&& other) noexcept
+        : head_(std::exchange(other.head_, nullptr))
+        , size_(std::exchange(other.size_, 0)) {
+    }
+
+    PersistentSingleLinkedList& operator=(
+        const PersistentSingleLinkedList& rhs) noexcept {
+        PersistentSingleLinkedList tmp(rhs);
+        swap(tmp);
+        return *this;
+    }
+
+    PersistentSingleLinkedList& operator=(
+        PersistentSingleLinkedList&& rhs) noexcept {
+        PersistentSingleLinkedList tmp(std::move(rhs));
+        swap(tmp);
+        return *this;
+    }
+
+    // Освобождает узлы, которые больше не использует ни одна версия
+    ~PersistentSingleLinkedList() {
+        Release(head_);
+    }
+
+    // Обменивает версии за время O(1)
+    void swap(PersistentSingleLinkedList& other) noexcept {
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator{head_};
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator{nullptr};
+    }
+
+    // Возвращает количество элементов в версии за время O(1)
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Сообщает, пуста ли версия, за время O(1)
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Возвращает первый элемент непустой версии
+    [[nodiscard]] const Type& GetFront() const noexcept {
+        assert(!IsEmpty());
+        return head_->value;
+    }
+
+    // Возвращает версию с элементом value в начале за время O(1).
+    // Исходная версия не меняется, новая разделяет с ней все узлы
+    [[nodiscard]] PersistentSingleLinkedList PushFront(
+        const Type& value) const {
+        return EmplaceFront(value);
+    }
+
+    [[nodiscard]] PersistentSingleLinkedList PushFront(Type&& value) const {
+        return EmplaceFront(std::move(value));
+    }
+
+    // Возвращает версию с элементом, созданным из args, в начале
+    template <typename... Args>
+    [[nodiscard]] PersistentSingleLinkedList EmplaceFront(
+        Args&&... args) const {
+        Node* node = new Node(head_, std::forward<Args>(args)...);
+        AddRef(head_);
+        return PersistentSingleLinkedList(node, size_ + 1);
+    }
+
+    // Возвращает версию без первого элемента за время O(1)
+    [[nodiscard]] PersistentSingleLinkedList PopFront() const noexcept {
+        assert(!IsEmpty());
+        return PersistentSingleLinkedList(AddRef(head_->next_node),
+                                          size_ - 1);
+    }
+
+private:
+    // Принимает ссылку на head
+    PersistentSingleLinkedList(Node* head, size_t size) noexcept
+        : head_(head)
+        , size_(size) {
+    }
+
+    static Node* AddRef(Node* node) noexcept {
+        if (node != nullptr) {
+            node->ref_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        return node;
+    }
+
+    // Отпускает ссылку на node. Освобождение идёт циклом, а не
+    // рекурсией, поэтому длинные цепочки не переполняют стек
+    static void Release(Node* node) noexcept {
+        while (node != nullptr &&
+               node->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Node* next = node->next_node;
+            delete node;
+            node = next;
+        }
+    }
+
+    Node* head_ = nullptr;
+    size_t size_ = 0;
+};
+
+template <typename Type>
+void swap(PersistentSingleLinkedList<Type>& lhs,
+          PersistentSingleLinkedList<Type>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type>
+bool operator==(const PersistentSingleLinkedList<Type>& lhs,
+                const PersistentSingleLinkedList<Type>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() &&
+           std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type>
+bool operator!=(const PersistentSingleLinkedList<Type>& lhs,
+                const PersistentSingleLinkedList<Type>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type>
+bool operator<(const PersistentSingleLinkedList<Type>& lhs,
+               const PersistentSingleLinkedList<Type>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(),
+                                        rhs.begin(), rhs.end());
+}
+
+template <typename Type>
+bool operator<=(const PersistentSingleLinkedList<Type>& lhs,
+                const PersistentSingleLinkedList<Type>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type>
+bool operator>(const PersistentSingleLinkedList<Type>& lhs,
+               const PersistentSingleLinkedList<Type>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type>
+bool operator>=(const PersistentSingleLinkedList<Type>& lhs,
+                const PersistentSingleLinkedList<Type>& rhs) {
+    return !(lhs < rhs);
+}
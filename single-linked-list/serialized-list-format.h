@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+/*
+ * Двоичный формат снимка списка тривиально копируемых элементов.
+ * Файл начинается с заголовка SerializedListHeader, за ним после
+ * выравнивающих нулевых байтов подряд лежат count элементов в
+ * машинном представлении. Смещение элементов кратно alignof(Type),
+ * поэтому отображённый в память файл можно читать без копирования.
+ * Формат не переносим между платформами с разным порядком байт или
+ * разным представлением Type
+ */
+struct SerializedListHeader {
+    std::array<char, 4> magic;
+    // Размер элемента в байтах, проверяется при чтении
+    uint32_t element_size;
+    // Количество элементов
+    uint64_t count;
+};
+
+static_assert(sizeof(SerializedListHeader) == 16);
+
+inline constexpr std::array<char, 4> kSerializedListMagic = {'S', 'L',
+                                                            'L', '1'};
+
+// Смещение первого элемента от начала снимка
+template <typename Type>
+constexpr size_t SerializedListDataOffset() noexcept {
+    constexpr size_t alignment = alignof(Type);
+    return (sizeof(SerializedListHeader) + alignment - 1) / alignment *
+           alignment;
+}
+
+template <typename Type>
+SerializedListHeader MakeSerializedListHeader(uint64_t count) noexcept {
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "serialization requires a trivially copyable Type");
+    return {kSerializedListMagic, static_cast<uint32_t>(sizeof(Type)),
+            count};
+}
+
+// Проверяет, что заголовок описывает снимок элементов Type
+// Выбрасывает std::runtime_error, если это не так
+template <typename Type>
+void CheckSerializedListHeader(const SerializedListHeader& header) {
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "serialization requires a trivially copyable Type");
+    if (header.magic != kSerializedListMagic) {
+        throw std::runtime_error("not a serialized list");
+    }
+    if (header.element_size != sizeof(Type)) {
+        throw std::runtime_error("serialized list element size mismatch");
+    }
+}
@@ -0,0 +1,389 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// Набор векторных инструкций, которым пользуются SimdKernels
+enum class SimdLevel {
+    kScalar,
+    // 128-битные векторы: SSE2 на x86-64, NEON и аналоги на других
+    // архитектурах
+    kVector128,
+    kAvx2,
+};
+
+/*
+ * Ядра поиска, подсчёта, суммирования и сравнения для блоков
+ * элементов, лежащих в памяти подряд.
+ * Для арифметических типов размером до 8 байт (кроме bool) ядра
+ * обрабатывают элементы векторами по 16 или 32 байта. На x86 набор
+ * инструкций выбирается во время выполнения: AVX2, если процессор его
+ * поддерживает, иначе SSE2. Компиляторы без векторных расширений GCC
+ * и прочие типы используют скалярные циклы.
+ * Результаты совпадают со скалярными алгоритмами, кроме Sum для
+ * чисел с плавающей точкой (порядок сложения другой) и MinMax для
+ * массивов с NaN (результат не определён)
+ */
+class SimdKernels {
+public:
+    // Обрабатываются ли элементы Type векторами
+    template <typename Type>
+    static constexpr bool kAccelerated =
+#if defined(__GNUC__)
+        std::is_arithmetic_v<Type> && !std::is_same_v<Type, bool> &&
+        sizeof(Type) <= 8;
+#else
+        false;
+#endif
+
+    // Возвращает набор инструкций, выбранный для этого процессора
+    [[nodiscard]] static SimdLevel GetLevel() noexcept {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        static const bool has_avx2 = __builtin_cpu_supports("avx2");
+        return has_avx2 ? SimdLevel::kAvx2 : SimdLevel::kVector128;
+#elif defined(__GNUC__)
+        return SimdLevel::kVector128;
+#else
+        return SimdLevel::kScalar;
+#endif
+    }
+
+    // Возвращает индекс первого элемента, равного value, либо size
+    template <typename Type>
+    [[nodiscard]] static size_t Find(const Type* data, size_t size,
+                                     const Type& value) {
+        if constexpr (kAccelerated<Type>) {
+#if defined(__GNUC__)
+            return Dispatch(
+                [&](auto bytes) {
+                    return FindBlocks<bytes()>(data, size, value);
+                },
+                [&] { return FindAvx2(data, size, value); });
+#endif
+        }
+        return static_cast<size_t>(std::find(data, data + size, value) -
+                                   data);
+    }
+
+    // Возвращает количество элементов, равных value
+    template <typename Type>
+    [[nodiscard]] static size_t Count(const Type* data, size_t size,
+                                      const Type& value) {
+        if constexpr (kAccelerated<Type>) {
+#if defined(__GNUC__)
+            return Dispatch(
+                [&](auto bytes) {
+                    return CountBlocks<bytes()>(data, size, value);
+                },
+                [&] { return CountAvx2(data, size, value); });
+#endif
+        }
+        return static_cast<size_t>(std::count(data, data + size, value));
+    }
+
+    // Возвращает сумму элементов, начиная с init
+    template <typename Type>
+    [[nodiscard]] static Type Sum(const Type* data, size_t size, Type init) {
+        if constexpr (kAccelerated<Type>) {
+#if defined(__GNUC__)
+            return Dispatch(
+                [&](auto bytes) {
+                    return SumBlocks<bytes()>(data, size, init);
+                },
+                [&] { return SumAvx2(data, size, init); });
+#endif
+        }
+        for (size_t i = 0; i < size; ++i) {
+            init += data[i];
+        }
+        return init;
+    }
+
+    // Возвращает наименьший и наибольший элементы непустого блока
+    template <typename Type>
+    [[nodiscard]] static std::pair<Type, Type> MinMax(const Type* data,
+                                                      size_t size) {
+        assert(size != 0);
+        if constexpr (kAccelerated<Type>) {
+#if defined(__GNUC__)
+            return Dispatch(
+                [&](auto bytes) {
+                    return MinMaxBlocks<bytes()>(data, size);
+                },
+                [&] { return MinMaxAvx2(data, size); });
+#endif
+        }
+        const auto [min, max] = std::minmax_element(data, data + size);
+        return {*min, *max};
+    }
+
+    // Сообщает, равны ли попарно элементы двух блоков длины size
+    template <typename Type>
+    [[nodiscard]] static bool Equal(const Type* lhs, const Type* rhs,
+                                    size_t size) {
+        if constexpr (kAccelerated<Type>) {
+#if defined(__GNUC__)
+            return Dispatch(
+                [&](auto bytes) {
+                    return EqualBlocks<bytes()>(lhs, rhs, size);
+                },
+                [&] { return EqualAvx2(lhs, rhs, size); });
+#endif
+        }
+        return std::equal(lhs, lhs + size, rhs);
+    }
+
+#if defined(__GNUC__)
+private:
+    template <size_t Bytes>
+    using BytesConstant = std::integral_constant<size_t, Bytes>;
+
+    // Вызывает avx2, если процессор поддерживает AVX2, иначе
+    // vector128 с 16-байтными векторами
+    template <typename Vector128, typename Avx2>
+    static auto Dispatch([[maybe_unused]] Vector128 vector128,
+                         [[maybe_unused]] Avx2 avx2) {
+#if defined(__x86_64__) || defined(__i386__)
+        if (GetLevel() == SimdLevel::kAvx2) {
+            return avx2();
+        }
+#endif
+        return vector128(BytesConstant<16>{});
+    }
+
+    // Вектор из Bytes / sizeof(Type) элементов Type
+    template <typename Type, size_t Bytes>
+    using Vector [[gnu::vector_size(Bytes)]] = Type;
+
+    // Знаковое целое размером с Type: тип элемента маски сравнения
+    template <typename Type>
+    using MaskLane = std::conditional_t<
+        sizeof(Type) == 1, int8_t,
+        std::conditional_t<
+            sizeof(Type) == 2, int16_t,
+            std::conditional_t<sizeof(Type) == 4, int32_t, int64_t>>>;
+
+    template <typename Type, size_t Bytes>
+    static constexpr size_t kLanes = Bytes / sizeof(Type);
+
+    // Загружает вектор из невыровненного адреса. Векторы передаются
+    // через параметры, а не возвращаются: возврат 32-байтного вектора
+    // из функции без атрибута target GCC считает сменой ABI
+    template <typename VectorType, typename Type>
+    [[gnu::always_inline]] static void Load(VectorType& result,
+                                            const Type* data) {
+        std::memcpy(&result, data, sizeof(result));
+    }
+
+    // Сообщает, есть ли в маске ненулевой элемент
+    template <typename VectorType>
+    [[gnu::always_inline]] static bool Any(const VectorType& mask) {
+        constexpr size_t kWords = sizeof(VectorType) / sizeof(uint64_t);
+        uint64_t words[kWords];
+        std::memcpy(words, &mask, sizeof(mask));
+        uint64_t result = 0;
+        for (size_t i = 0; i < kWords; ++i) {
+            result |= words[i];
+        }
+        return result != 0;
+    }
+
+    template <size_t Bytes, typename Type>
+    [[gnu::always_inline]] static size_t FindBlocks(const Type* data,
+                                                    size_t size,
+                                                    Type value) {
+        using V = Vector<Type, Bytes>;
+        const V needle = value - V{};
+        size_t i = 0;
+        for (; i + kLanes<Type, Bytes> <= size; i += kLanes<Type, Bytes>) {
+            V block;
+            Load(block, data + i);
+            if (Any(block == needle)) {
+                break;
+            }
+        }
+        // Остаток и блок с совпадением досматриваются поэлементно
+        for (; i < size; ++i) {
+            if (data[i] == value) {
+                return i;
+            }
+        }
+        return size;
+    }
+
+    template <size_t Bytes, typename Type>
+    [[gnu::always_inline]] static size_t CountBlocks(const Type* data,
+                                                     size_t size,
+                                                     Type value) {
+        using V = Vector<Type, Bytes>;
+        // Сравнение векторов даёт вектор знаковых целых масок того же
+        // размера: 0 либо -1
+        using Lane = MaskLane<Type>;
+        using M = Vector<Lane, Bytes>;
+        constexpr size_t kLaneCount = kLanes<Type, Bytes>;
+        // Счётчики в элементах маски сбрасываются в result раньше,
+        // чем могут переполниться
+        constexpr size_t kFlushBlocks = std::min<size_t>(
+            std::numeric_limits<Lane>::max(), size_t{1} << 20);
+        const V needle = value - V{};
+        size_t result = 0;
+        size_t i = 0;
+        while (i + kLaneCount <= size) {
+            M counters = {};
+            for (size_t blocks = 0;
+                 blocks < kFlushBlocks && i + kLaneCount <= size;
+                 ++blocks, i += kLaneCount) {
+                // Совпавший элемент маски равен -1
+                V block;
+                Load(block, data + i);
+                counters -= block == needle;
+            }
+            for (size_t lane = 0; lane < kLaneCount; ++lane) {
+                result += static_cast<size_t>(counters[lane]);
+            }
+        }
+        for (; i < size; ++i) {
+            result += data[i] == value;
+        }
+        return result;
+    }
+
+    template <size_t Bytes, typename Type>
+    [[gnu::always_inline]] static Type SumBlocks(const Type* data,
+                                                 size_t size, Type init) {
+        using V = Vector<Type, Bytes>;
+        V sums = {};
+        size_t i = 0;
+        for (; i + kLanes<Type, Bytes> <= size; i += kLanes<Type, Bytes>) {
+            V block;
+            Load(block, data + i);
+            sums += block;
+        }
+        for (size_t lane = 0; lane < kLanes<Type, Bytes>; ++lane) {
+            init += sums[lane];
+        }
+        for (; i < size; ++i) {
+            init += data[i];
+        }
+        return init;
+    }
+
+    template <size_t Bytes, typename Type>
+    [[gnu::always_inline]] static std::pair<Type, Type> MinMaxBlocks(
+        const Type* data, size_t size) {
+        using V = Vector<Type, Bytes>;
+        Type min = data[0];
+        Type max = data[0];
+        size_t i = 0;
+        if (size >= kLanes<Type, Bytes>) {
+            V mins;
+            Load(mins, data);
+            V maxs = mins;
+            for (i = kLanes<Type, Bytes>; i + kLanes<Type, Bytes> <= size;
+                 i += kLanes<Type, Bytes>) {
+                V block;
+                Load(block, data + i);
+                mins = block < mins ? block : mins;
+                maxs = block > maxs ? block : maxs;
+            }
+            for (size_t lane = 0; lane < kLanes<Type, Bytes>; ++lane) {
+                min = std::min<Type>(min, mins[lane]);
+                max = std::max<Type>(max, maxs[lane]);
+            }
+        }
+        for (; i < size; ++i) {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+        return {min, max};
+    }
+
+    template <size_t Bytes, typename Type>
+    [[gnu::always_inline]] static bool EqualBlocks(const Type* lhs,
+                                                   const Type* rhs,
+                                                   size_t size) {
+        using V = Vector<Type, Bytes>;
+        size_t i = 0;
+        for (; i + kLanes<Type, Bytes> <= size; i += kLanes<Type, Bytes>) {
+            V lhs_block;
+            V rhs_block;
+            Load(lhs_block, lhs + i);
+            Load(rhs_block, rhs + i);
+            if (Any(lhs_block != rhs_block)) {
+                return false;
+            }
+        }
+        for (; i < size; ++i) {
+            if (!(lhs[i] == rhs[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Варианты для AVX2. Атрибут target позволяет компилятору
+    // использовать AVX2 только в этих функциях, поэтому остальной код
+    // работает и на процессорах без AVX2
+#if defined(__x86_64__) || defined(__i386__)
+    template <typename Type>
+    [[gnu::target("avx2")]] static size_t FindAvx2(const Type* data,
+                                                   size_t size,
+                                                   Type value) {
+        return FindBlocks<32>(data, size, value);
+    }
+
+    template <typename Type>
+    [[gnu::target("avx2")]] static size_t CountAvx2(const Type* data,
+                                                    size_t size,
+                                                    Type value) {
+        return CountBlocks<32>(data, size, value);
+    }
+
+    template <typename Type>
+    [[gnu::target("avx2")]] static Type SumAvx2(const Type* data,
+                                                size_t size, Type init) {
+        return SumBlocks<32>(data, size, init);
+    }
+
+    template <typename Type>
+    [[gnu::target("avx2")]] static std::pair<Type, Type> MinMaxAvx2(
+        const Type* data, size_t size) {
+        return MinMaxBlocks<32>(data, size);
+    }
+
+    template <typename Type>
+    [[gnu::target("avx2")]] static bool EqualAvx2(const Type* lhs,
+                                                  const Type* rhs,
+                                                  size_t size) {
+        return EqualBlocks<32>(lhs, rhs, size);
+    }
+#else
+    template <typename Type>
+    static size_t FindAvx2(const Type*, size_t, Type) {
+        return 0;
+    }
+    template <typename Type>
+    static size_t CountAvx2(const Type*, size_t, Type) {
+        return 0;
+    }
+    template <typename Type>
+    static Type SumAvx2(const Type*, size_t, Type init) {
+        return init;
+    }
+    template <typename Type>
+    static std::pair<Type, Type> MinMaxAvx2(const Type* data, size_t) {
+        return {data[0], data[0]};
+    }
+    template <typename Type>
+    static bool EqualAvx2(const Type*, const Type*, size_t) {
+        return false;
+    }
+#endif
+#endif
+};
@@ -1,19 +1,60 @@
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <concepts>
 #include <cstddef>
-#include <iostream>
-#include <string>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
-// добавьте неоходимые include-директивы сюда
+#include "list-stats.h"
+#include "serialized-list-format.h"
 
-template <typename Type>
+// Тег для SingleLinkedList::Clear: очистить список, сохранив узлы
+// для повторного использования
+struct KeepCapacity {
+    explicit KeepCapacity() = default;
+};
+inline constexpr KeepCapacity kKeepCapacity{};
+
+// Тег конструктора SingleLinkedList из диапазона C++20, у которого
+// тип конца может отличаться от типа итератора
+struct FromRange {
+    explicit FromRange() = default;
+};
+inline constexpr FromRange kFromRange{};
+
+/*
+ * Односвязный список.
+ * StatsPolicy задаёт сбор статистики операций (см. list-stats.h).
+ * По умолчанию NoListStats: статистика не собирается и не влияет
+ * ни на размер списка, ни на скорость его операций
+ */
+template <typename Type, typename Allocator = std::allocator<Type>,
+          typename StatsPolicy = NoListStats>
 class SingleLinkedList {
     // Узел списка
     struct Node {
         Node() = default;
-        Node(const Type& val, Node* next);
+        // Создаёт значение узла на месте из аргументов args
+        template <typename... Args>
+        constexpr explicit Node(Node* next, Args&&... args)
+            : value(std::forward<Args>(args)...)
+            , next_node(next) {
+        }
         Type value;
         Node* next_node = nullptr;
     };
@@ -24,14 +65,25 @@ class SingleLinkedList {
     // ValueType — совпадает с Type (для Iterator) либо с
     // const Type (для ConstIterator)
     template <typename ValueType>
-    class BasicIterator {
+    class BasicIterator : private ListTraversalCounter<StatsPolicy> {
+        using Counter = ListTraversalCounter<StatsPolicy>;
+
         // Класс списка объявляется дружественным, чтобы из методов
         // списка был доступ к приватной области итератора
         friend class SingleLinkedList;
 
         // Конвертирующий конструктор итератора из указателя на
         // узел списка
-        explicit BasicIterator(Node* node);
+        constexpr explicit BasicIterator(Node* node) {
+            node_ = node;
+        }
+
+        // Итератор начала обхода, шаги которого учитываются в
+        // статистике списка
+        constexpr BasicIterator(Node* node, StatsPolicy* stats) noexcept
+            : Counter(stats)
+            , node_(node) {
+        }
 
     public:
         // Объявленные ниже типы сообщают стандартной библиотеке о
@@ -57,7 +109,10 @@ class SingleLinkedList {
         // копирующего конструктора
         // При ValueType, совпадающем с const Type, играет роль
         // конвертирующего конструктора
-        BasicIterator(const BasicIterator<Type>& other) noexcept;
+        constexpr BasicIterator(const BasicIterator<Type>& other) noexcept
+            : Counter(other) {
+            node_ = other.node_;
+        }
 
         // Чтобы компилятор не выдавал предупреждение об отсутствии
         // оператора = при наличии пользовательского конструктора
@@ -70,32 +125,53 @@ class SingleLinkedList {
         // выступает константный итератор)
         // Два итератора равны, если они ссылаются на один и тот же
         // элемент списка либо на end()
-        [[nodiscard]] bool operator==
-        (const BasicIterator<const Type>& rhs) const noexcept;
+        [[nodiscard]] constexpr bool operator==
+            (const BasicIterator<const Type>& rhs) const noexcept {
+            return node_ == rhs.node_;
+            
+        }
 
         // Оператор проверки итераторов на неравенство
         // Противоположен !=
-        [[nodiscard]] bool operator!=
-        (const BasicIterator<const Type>& rhs) const noexcept;
+        [[nodiscard]] constexpr bool operator!=
+            (const BasicIterator<const Type>& rhs) const noexcept {
+            return node_ != rhs.node_;
+        }
 
         // Оператор сравнения итераторов (в роли второго аргумента
         // итератор)
         // Два итератора равны, если они ссылаются на один и тот же
         // элемент списка либо на end()
-        [[nodiscard]] bool operator==
-        (const BasicIterator<Type>& rhs) const noexcept;
+        [[nodiscard]] constexpr bool operator==
+            (const BasicIterator<Type>& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
 
         // Оператор проверки итераторов на неравенство
         // Противоположен !=
-        [[nodiscard]] bool operator!=
-        (const BasicIterator<Type>& rhs) const noexcept;
+        [[nodiscard]] constexpr bool operator!=
+            (const BasicIterator<Type>& rhs) const noexcept {
+            return node_ != rhs.node_;
+        }
+
+        // Сравнение с std::default_sentinel проверяет, дошёл ли
+        // итератор до конца списка. Оператор != C++20 выводит сам
+        [[nodiscard]] constexpr bool operator==
+            (std::default_sentinel_t) const noexcept {
+            return node_ == nullptr;
+        }
 
         // Оператор прединкремента. После его вызова итератор
         // указывает на следующий элемент списка
         // Возвращает ссылку на самого себя
         // Инкремент итератора, не указывающего на существующий
         // элемент списка, приводит к неопределённому поведению
-        BasicIterator& operator++() noexcept;
+        constexpr BasicIterator& operator++() noexcept {
+            assert(node_ != nullptr);
+            this->node_ = this->node_->next_node;
+            this->CountStep();
+            return *this;
+        }
 
         // Оператор постинкремента. После его вызова итератор
         // указывает на следующий элемент списка
@@ -103,37 +179,211 @@ class SingleLinkedList {
         // Инкремент итератора, не указывающего на существующий
         // элемент списка,
         // приводит к неопределённому поведению
-        BasicIterator operator++(int) noexcept;
+        constexpr BasicIterator operator++(int) noexcept {
+            auto old_value(*this);
+            ++(*this);
+            return old_value;
+        }
 
         // Операция разыменования. Возвращает ссылку на текущий
         // элемент
         // Вызов этого оператора у итератора, не указывающего на
         // существующий элемент списка, приводит к неопределённому
         // поведению
-        [[nodiscard]] reference operator*() const noexcept;
+        [[nodiscard]] constexpr reference operator*() const noexcept {
+            assert(node_ != nullptr);
+            return node_->value;
+        }
 
         // Операция доступа к члену класса. Возвращает указатель на
         // текущий элемент списка
         // Вызов этого оператора у итератора, не указывающего на
         // существующий элемент списка, приводит к неопределённому
         // поведению
-        [[nodiscard]] pointer operator->() const noexcept;
+        [[nodiscard]] constexpr pointer operator->() const noexcept {
+            assert(node_ != nullptr);
+            return &node_->value;
+        }
 
     private:
         Node* node_ = nullptr;
     };
 
+    // Аллокатор узлов: пользовательский Allocator, перепривязанный
+    // к типу Node
+    using NodeAllocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    // Память узла, ожидающая повторного использования. Размещается
+    // на месте разрушенного узла
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    // Отцепленная от списка цепочка узлов, завершённая nullptr
+    struct Chain {
+        Node* first = nullptr;
+        Node* last = nullptr;
+        size_t count = 0;
+    };
+
+    // Разрешает перегрузку только для входных итераторов
+    template <typename InputIt>
+    using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+        typename std::iterator_traits<InputIt>::iterator_category,
+        std::input_iterator_tag>>;
+
 public:
 
     SingleLinkedList() = default;
-    SingleLinkedList(std::initializer_list<Type> values);
-    SingleLinkedList(const SingleLinkedList& other);
+
+    constexpr explicit SingleLinkedList(const Allocator& alloc)
+        : alloc_(alloc) {
+    }
+
+    constexpr SingleLinkedList(std::initializer_list<Type> values,
+                     const Allocator& alloc = Allocator())
+        : SingleLinkedList(values.begin(), values.end(), alloc) {
+    }
+
+    // Создаёт список из элементов диапазона [first, last)
+    // Узлы связываются в цепочку за один проход
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    constexpr SingleLinkedList(InputIt first, InputIt last,
+                     const Allocator& alloc = Allocator())
+        : alloc_(alloc) {
+        LinkChainAfter(&head_, CreateChain(first, last));
+    }
+
+    // Создаёт список из элементов диапазона range, например из
+    // ленивой цепочки std::views. Узлы связываются в цепочку за один
+    // проход по диапазону
+    template <std::ranges::input_range Range>
+    constexpr SingleLinkedList(FromRange, Range&& range,
+                               const Allocator& alloc = Allocator())
+        : alloc_(alloc) {
+        LinkChainAfter(&head_, CreateChain(std::ranges::begin(range),
+                                           std::ranges::end(range)));
+    }
+
+    constexpr SingleLinkedList(const SingleLinkedList& other)
+        : alloc_(NodeTraits::select_on_container_copy_construction(
+                     other.alloc_))
+        , stats_(CopyStatsPolicy(other.stats_)) {
+        LinkChainAfter(&head_, CreateChain(other.begin(), other.end()));
+    }
+
+    // Перемещающий конструктор. Забирает узлы other за время O(1),
+    // other становится пустым
+    constexpr SingleLinkedList(SingleLinkedList&& other) noexcept(
+        std::is_nothrow_copy_constructible_v<StatsPolicy>)
+        : alloc_(std::move(other.alloc_))
+        , stats_(CopyStatsPolicy(other.stats_)) {
+        StealNodes(other);
+        free_nodes_ = std::exchange(other.free_nodes_, nullptr);
+        free_count_ = std::exchange(other.free_count_, 0);
+        node_cache_size_ = std::exchange(other.node_cache_size_, 0);
+    }
 
     // Обменивает содержимое списков за время O(1)
-    void swap(SingleLinkedList& other) noexcept;
-    
-    SingleLinkedList& operator=(const SingleLinkedList& rhs);
+    // Аллокаторы обмениваются, только если этого требует
+    // propagate_on_container_swap, иначе они должны быть равны
+    constexpr void swap(SingleLinkedList& other) noexcept {
+        if constexpr (NodeTraits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(alloc_, other.alloc_);
+        } else {
+            assert(alloc_ == other.alloc_);
+        }
+        std::swap(head_.next_node, other.head_.next_node);
+        std::swap(size_, other.size_);
+        std::swap(last_node_, other.last_node_);
+        std::swap(free_nodes_, other.free_nodes_);
+        std::swap(free_count_, other.free_count_);
+        std::swap(node_cache_size_, other.node_cache_size_);
+        ++version_;
+        ++other.version_;
+    }
 
+    /*
+     * Копирующее присваивание. Существующие узлы используются
+     * повторно: их значения перезаписываются значениями rhs, а
+     * выделяются или удаляются только недостающие или лишние узлы.
+     * Если присваивание элемента выбросит исключение, список
+     * останется в согласованном состоянии, но часть элементов
+     * может быть уже перезаписана. Для типов без копирующего
+     * присваивания список собирается заново со строгой гарантией
+     */
+    constexpr SingleLinkedList& operator=(const SingleLinkedList& rhs) {
+        if (this == &rhs) {
+            return *this;
+        }
+        if constexpr (NodeTraits::
+                      propagate_on_container_copy_assignment::value) {
+            if (alloc_ != rhs.alloc_) {
+                Clear();
+                ShrinkToFit();
+            }
+            alloc_ = rhs.alloc_;
+        }
+        if constexpr (std::is_copy_assignable_v<Type>) {
+            AssignReusingNodes(rhs.begin(), rhs.end());
+        } else {
+            Assign(rhs.begin(), rhs.end());
+        }
+        return *this;
+    }
+
+    // Перемещающее присваивание. Если аллокаторы позволяют, узлы rhs
+    // забираются за время O(1). Иначе элементы rhs перемещаются в
+    // новые узлы, выделенные аллокатором этого списка
+    constexpr SingleLinkedList& operator=(SingleLinkedList&& rhs) noexcept(
+        NodeTraits::propagate_on_container_move_assignment::value ||
+        NodeTraits::is_always_equal::value) {
+        if (this == &rhs) {
+            return *this;
+        }
+        if constexpr (NodeTraits::
+                      propagate_on_container_move_assignment::value) {
+            Clear();
+            ShrinkToFit();
+            alloc_ = std::move(rhs.alloc_);
+            StealNodes(rhs);
+        } else {
+            if (alloc_ == rhs.alloc_) {
+                Clear();
+                StealNodes(rhs);
+            } else {
+                SingleLinkedList tmp(get_allocator());
+                for (auto it = rhs.begin(); it != rhs.end(); ++it) {
+                    tmp.PushBack(std::move(*it));
+                }
+                rhs.Clear();
+                Clear();
+                swap(tmp);
+            }
+        }
+        return *this;
+    }
+
+    /*
+     * Заменяет содержимое списка элементами диапазона [first, last).
+     * Новые узлы создаются до удаления старых, поэтому при
+     * исключении список останется в прежнем состоянии
+     */
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    constexpr void Assign(InputIt first, InputIt last) {
+        Chain chain = CreateChain(first, last);
+        Clear();
+        LinkChainAfter(&head_, chain);
+    }
+
+    constexpr void Assign(std::initializer_list<Type> values) {
+        Assign(values.begin(), values.end());
+    }
+
+    using allocator_type = Allocator;
     using value_type = Type;
     using reference = value_type&;
     using const_reference = const value_type&;
@@ -144,68 +394,381 @@ public:
     // элементам списка
     using ConstIterator = BasicIterator<const Type>;
 
+    /*
+     * Разреженный индекс списка: указатели на каждый chunk_size-й
+     * узел. Делит список на участки, которые можно обходить
+     * независимо друг от друга, например из разных потоков
+     * (см. parallel-list-algorithms.h).
+     * Индекс запоминает версию списка и становится недействительным
+     * после любого изменения его структуры: вставки, удаления,
+     * переноса или перестановки узлов. Изменение значений элементов
+     * индекс не затрагивает. Индекс не должен переживать список
+     */
+    class ChunkIndex {
+    public:
+        ChunkIndex() = default;
+
+        // Возвращает количество участков. Все участки, кроме,
+        // возможно, последнего, содержат GetChunkSize() элементов
+        [[nodiscard]] size_t GetChunkCount() const noexcept {
+            return starts_.size();
+        }
+
+        [[nodiscard]] size_t GetChunkSize() const noexcept {
+            return chunk_size_;
+        }
+
+        // Сообщает, построен ли индекс по текущему состоянию list
+        [[nodiscard]] bool IsValidFor(
+            const SingleLinkedList& list) const noexcept {
+            return list_ == &list && version_ == list.version_;
+        }
+
+    private:
+        friend class SingleLinkedList;
+
+        const SingleLinkedList* list_ = nullptr;
+        uint64_t version_ = 0;
+        size_t chunk_size_ = 0;
+        // Первые узлы участков
+        std::vector<Node*> starts_;
+    };
+
+    // Возвращает копию аллокатора, которым создан список
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return allocator_type(alloc_);
+    }
+
     // Возвращает итератор, указывающий на позицию перед первым
     // элементом односвязного списка.
     // Разыменовывать этот итератор нельзя - попытка разыменования
     // приведёт к неопределённому поведению
-    [[nodiscard]] Iterator before_begin() noexcept;
+    [[nodiscard]] constexpr Iterator before_begin() noexcept {
+        return Iterator{&head_};
+    }
 
     // Возвращает константный итератор, указывающий на позицию
     // перед первым элементом односвязного списка.
     // Разыменовывать этот итератор нельзя - попытка разыменования
     // приведёт к неопределённому поведению
-    [[nodiscard]] ConstIterator cbefore_begin() const noexcept;
+    [[nodiscard]] constexpr ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator(const_cast<Node*>(&head_)); ;
+    }
 
     // Возвращает константный итератор, указывающий на позицию
     // перед первым элементом односвязного списка.
     // Разыменовывать этот итератор нельзя - попытка разыменования
     // приведёт к неопределённому поведению
-    [[nodiscard]] ConstIterator before_begin() const noexcept;
+    [[nodiscard]] constexpr ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
 
     // Возвращает итератор, ссылающийся на первый элемент
     // Если список пустой, возвращённый итератор будет равен end()
-    [[nodiscard]] Iterator begin() noexcept;
+    [[nodiscard]] constexpr Iterator begin() noexcept {
+        stats_.OnTraversal();
+        return Iterator(head_.next_node, &stats_);
+    }
 
     // Возвращает итератор, указывающий на позицию, следующую за
     // последним элементом односвязного списка
     // Разыменовывать этот итератор нельзя — попытка разыменования
     // приведёт к неопределённому поведению
-    [[nodiscard]] Iterator end() noexcept;
+    [[nodiscard]] constexpr Iterator end() noexcept {
+        return Iterator{nullptr};
+    }
 
     // Возвращает константный итератор, ссылающийся на первый
     // элемент
     // Если список пустой, возвращённый итератор будет равен end()
     // Результат вызова эквивалентен вызову метода cbegin()
-    [[nodiscard]] ConstIterator begin() const noexcept;
+    [[nodiscard]] constexpr ConstIterator begin() const noexcept {
+        return cbegin();
+    }
 
     // Возвращает константный итератор, указывающий на позицию,
     // следующую за последним элементом односвязного списка
     // Разыменовывать этот итератор нельзя — попытка разыменования
     // приведёт к неопределённому поведению
     // Результат вызова эквивалентен вызову метода cend()
-    [[nodiscard]] ConstIterator end() const noexcept;
+    [[nodiscard]] constexpr ConstIterator end() const noexcept {
+        return ConstIterator{nullptr};
+    }
 
     // Возвращает константный итератор, ссылающийся на первый
     // элемент
     // Если список пустой, возвращённый итератор будет равен cend()
-    [[nodiscard]] ConstIterator cbegin() const noexcept;
+    [[nodiscard]] constexpr ConstIterator cbegin() const noexcept {
+        stats_.OnTraversal();
+        return ConstIterator(head_.next_node, &stats_);
+    }
 
     // Возвращает константный итератор, указывающий на позицию,
     // следующую за последним элементом односвязного списка
     // Разыменовывать этот итератор нельзя — попытка разыменования
     // приведёт к неопределённому поведению
-    [[nodiscard]] ConstIterator cend() const noexcept;
+    [[nodiscard]] constexpr ConstIterator cend() const noexcept {
+        return ConstIterator{nullptr};
+    }
+
+    // Возвращает итератор на последний элемент списка за время O(1),
+    // а для пустого списка — before_begin(). Вставка после него
+    // добавляет элементы в конец списка
+    [[nodiscard]] constexpr Iterator before_end() noexcept {
+        return last_node_ != nullptr ? Iterator{last_node_} : before_begin();
+    }
+
+    [[nodiscard]] constexpr ConstIterator cbefore_end() const noexcept {
+        return last_node_ != nullptr ? ConstIterator{last_node_}
+                                     : cbefore_begin();
+    }
+
+    [[nodiscard]] constexpr ConstIterator before_end() const noexcept {
+        return cbefore_end();
+    }
 
     // Возвращает количество элементов в списке за время O(1)
-    [[nodiscard]] size_t GetSize() const noexcept;
+    [[nodiscard]] constexpr size_t GetSize() const noexcept {
+        return size_;
+    }
 
     // Сообщает, пустой ли список за время O(1)
-    [[nodiscard]] bool IsEmpty() const noexcept;
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Возвращает итератор на первый элемент, равный value, либо end()
+    [[nodiscard]] constexpr Iterator Find(const Type& value) {
+        return Iterator{FindNode(value)};
+    }
+
+    [[nodiscard]] constexpr ConstIterator Find(const Type& value) const {
+        return ConstIterator{FindNode(value)};
+    }
+
+    // Возвращает количество элементов, равных value
+    [[nodiscard]] constexpr size_t Count(const Type& value) const {
+        size_t count = 0;
+        for (const Node* node = head_.next_node; node != nullptr;
+             node = node->next_node) {
+            count += node->value == value;
+        }
+        return count;
+    }
+
+    // Сообщает, есть ли в списке элемент, равный value
+    [[nodiscard]] constexpr bool Contains(const Type& value) const {
+        return FindNode(value) != nullptr;
+    }
+
+    // Возвращает сумму элементов, начиная с init
+    [[nodiscard]] constexpr Type Sum(Type init = Type()) const {
+        for (const Node* node = head_.next_node; node != nullptr;
+             node = node->next_node) {
+            init = std::move(init) + node->value;
+        }
+        return init;
+    }
+
+    // Возвращает копии наименьшего и наибольшего элементов непустого
+    // списка
+    [[nodiscard]] constexpr std::pair<Type, Type> MinMax() const {
+        assert(!IsEmpty());
+        const Node* min = head_.next_node;
+        const Node* max = min;
+        for (const Node* node = min->next_node; node != nullptr;
+             node = node->next_node) {
+            if (node->value < min->value) {
+                min = node;
+            }
+            if (!(node->value < max->value)) {
+                max = node;
+            }
+        }
+        return {min->value, max->value};
+    }
+
+    /*
+     * Строит индекс участков по chunk_size элементов за время O(N).
+     * Построение — последовательный обход списка, поэтому индекс
+     * выгодно строить один раз и использовать для многих обходов,
+     * пока список не изменился
+     */
+    [[nodiscard]] ChunkIndex BuildChunkIndex(size_t chunk_size) const {
+        assert(chunk_size > 0);
+        ChunkIndex index;
+        index.list_ = this;
+        index.version_ = version_;
+        index.chunk_size_ = chunk_size;
+        index.starts_.reserve((size_ + chunk_size - 1) / chunk_size);
+        size_t position = 0;
+        for (Node* node = head_.next_node; node != nullptr;
+             node = node->next_node, ++position) {
+            if (position % chunk_size == 0) {
+                index.starts_.push_back(node);
+            }
+        }
+        return index;
+    }
+
+    // Возвращает границы участка chunk индекса index. Индекс должен
+    // быть действительным для этого списка
+    [[nodiscard]] std::pair<Iterator, Iterator> GetChunk(
+        const ChunkIndex& index, size_t chunk) noexcept {
+        const auto [first, last] = ChunkBounds(index, chunk);
+        return {Iterator{first}, Iterator{last}};
+    }
+
+    [[nodiscard]] std::pair<ConstIterator, ConstIterator> GetChunk(
+        const ChunkIndex& index, size_t chunk) const noexcept {
+        const auto [first, last] = ChunkBounds(index, chunk);
+        return {ConstIterator{first}, ConstIterator{last}};
+    }
+
+    // Число узлов, на которое ForEachPrefetched по умолчанию
+    // забегает вперёд, и наибольшее допустимое
+    static constexpr size_t kDefaultPrefetchDistance = 8;
+    static constexpr size_t kMaxPrefetchDistance = 64;
+
+    /*
+     * Вызывает func(value) для элементов по порядку. Проход по
+     * цепочке идёт на distance узлов впереди func: найденные узлы
+     * ждут своей очереди в окне. Сам переход к следующему узлу всё
+     * так же ждёт загрузки текущего, поэтому без address это просто
+     * обход с окном. Он помогает, только если работу func можно
+     * совместить с этим ожиданием.
+     * address(value) возвращает адрес памяти вне узла, которую func
+     * прочитает для элемента, например запись таблицы по ключу из
+     * элемента, либо nullptr. Эта память запрашивается в кэш командой
+     * предвыборки, как только проход находит узел, то есть за
+     * distance элементов до вызова func.
+     * func не должна менять структуру списка
+     */
+    template <typename Func>
+    void ForEachPrefetched(Func func,
+                           size_t distance = kDefaultPrefetchDistance) {
+        NoPrefetchAddress address;
+        VisitPrefetched<Type>(func, address, distance);
+    }
+
+    template <typename Func>
+    void ForEachPrefetched(Func func,
+                           size_t distance = kDefaultPrefetchDistance) const {
+        NoPrefetchAddress address;
+        VisitPrefetched<const Type>(func, address, distance);
+    }
+
+    template <typename Func, typename Address>
+        requires std::invocable<Address&, const Type&>
+    void ForEachPrefetched(Func func, Address address,
+                           size_t distance = kDefaultPrefetchDistance) {
+        VisitPrefetched<Type>(func, address, distance);
+    }
+
+    template <typename Func, typename Address>
+        requires std::invocable<Address&, const Type&>
+    void ForEachPrefetched(Func func, Address address,
+                           size_t distance = kDefaultPrefetchDistance) const {
+        VisitPrefetched<const Type>(func, address, distance);
+    }
+
+    // Размер пакета ForEachBatch по умолчанию и наибольший допустимый
+    static constexpr size_t kDefaultTraversalBatch = 64;
+    static constexpr size_t kMaxTraversalBatch = 256;
+
+    /*
+     * Проходит список пакетами по batch элементов: собирает указатели
+     * на элементы очередного участка и вызывает func для их
+     * std::span. Внутри пакета func работает с массивом, а не с
+     * цепочкой, поэтому может обращаться к элементам в любом порядке
+     * и независимо друг от друга. Последний пакет может быть короче.
+     * func не должна менять структуру списка
+     */
+    template <typename Func>
+    void ForEachBatch(Func func, size_t batch = kDefaultTraversalBatch) {
+        VisitBatches<Type>(func, batch);
+    }
+
+    template <typename Func>
+    void ForEachBatch(Func func,
+                      size_t batch = kDefaultTraversalBatch) const {
+        VisitBatches<const Type>(func, batch);
+    }
+
+    // Возвращает снимок статистики списка. При выключенной
+    // статистике все счётчики нулевые
+    [[nodiscard]] ListStats GetStats() const noexcept {
+        return stats_.GetStats();
+    }
+
+    // Возвращает объект политики статистики, например чтобы задать
+    // имя списка в ListStatsRegistry
+    [[nodiscard]] StatsPolicy& GetStatsPolicy() noexcept {
+        return stats_;
+    }
+
+    [[nodiscard]] const StatsPolicy& GetStatsPolicy() const noexcept {
+        return stats_;
+    }
 
     // Вставляет элемент value в начало списка за время O(1)
-    void PushFront(const Type& value);
+    constexpr void PushFront(const Type& value) {
+        EmplaceFront(value);
+    }
+
+    // Перемещает элемент value в начало списка за время O(1)
+    constexpr void PushFront(Type&& value) {
+        EmplaceFront(std::move(value));
+    }
+
+    // Создаёт элемент из аргументов args прямо в новом узле в
+    // начале списка за время O(1)
+    // Возвращает ссылку на созданный элемент
+    template <typename... Args>
+    constexpr reference EmplaceFront(Args&&... args) {
+        Node* new_node =
+            CreateNode(head_.next_node, std::forward<Args>(args)...);
+        if (head_.next_node == nullptr) {
+            last_node_ = new_node;
+        }
+        head_.next_node = new_node;
+        ++size_;
+        ++version_;
+        stats_.OnPushFront();
+        stats_.OnSize(size_);
+        return new_node->value;
+    }
 
-    void PushBack(const Type& value);
+    // Вставляет элемент value в конец списка за время O(1)
+    constexpr void PushBack(const Type& value) {
+        EmplaceBack(value);
+    }
+
+    // Перемещает элемент value в конец списка за время O(1)
+    constexpr void PushBack(Type&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    // Создаёт элемент из аргументов args прямо в новом узле в
+    // конце списка за время O(1)
+    // Возвращает ссылку на созданный элемент
+    template <typename... Args>
+    constexpr reference EmplaceBack(Args&&... args) {
+        Node* new_node = CreateNode(nullptr, std::forward<Args>(args)...);
+
+        if (last_node_ != nullptr) {
+            last_node_ -> next_node = new_node;
+        }
+        ++size_;
+        ++version_;
+        last_node_ = new_node;
+        if (head_.next_node == nullptr) {
+            head_.next_node = last_node_;
+        }
+        stats_.OnPushBack();
+        stats_.OnSize(size_);
+        return new_node->value;
+    }
 
     /*
      * Вставляет элемент value после элемента, на который указывает
@@ -214,63 +777,865 @@ public:
      * Если при создании элемента будет выброшено исключение,
      * список останется в прежнем состоянии
      */
-    Iterator InsertAfter(ConstIterator pos, const Type& value);
+    constexpr Iterator InsertAfter(ConstIterator pos, const Type& value) {
+        return EmplaceAfter(pos, value);
+    }
+
+    /*
+     * Вставляет элементы диапазона [first, last) после pos.
+     * Узлы создаются отдельной цепочкой и присоединяются к списку
+     * целиком, поэтому при исключении список останется в прежнем
+     * состоянии
+     * Возвращает итератор на последний вставленный элемент либо pos,
+     * если диапазон пуст
+     */
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    constexpr Iterator InsertAfter(ConstIterator pos, InputIt first, InputIt last) {
+        assert(pos.node_ != nullptr);
+        stats_.OnInsertAfter();
+        Chain chain = CreateChain(first, last);
+        if (chain.count == 0) {
+            return Iterator{pos.node_};
+        }
+        LinkChainAfter(pos.node_, chain);
+        return Iterator{chain.last};
+    }
+
+    // Перемещает элемент value в позицию после pos
+    // Возвращает итератор на вставленный элемент
+    constexpr Iterator InsertAfter(ConstIterator pos, Type&& value) {
+        return EmplaceAfter(pos, std::move(value));
+    }
+
+    /*
+     * Создаёт элемент из аргументов args прямо в новом узле после
+     * элемента, на который указывает pos.
+     * Возвращает итератор на вставленный элемент
+     * Если при создании элемента будет выброшено исключение,
+     * список останется в прежнем состоянии
+     */
+    template <typename... Args>
+    constexpr Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
+        assert(pos.node_ != nullptr);
+
+        Node* ptr_new_node = CreateNode(pos.node_->next_node,
+                                        std::forward<Args>(args)...);
+
+        pos.node_->next_node = ptr_new_node;
+        if (ptr_new_node->next_node == nullptr) {
+            last_node_ = ptr_new_node;
+        }
+        ++size_;
+        ++version_;
+        stats_.OnInsertAfter();
+        stats_.OnSize(size_);
+        return Iterator{ptr_new_node};
+    }
+
+    constexpr void PopFront() noexcept {
+        assert(!IsEmpty());
+
+        Node* ptr_next_node = head_.next_node -> next_node;
+        DestroyNode(head_.next_node);
 
-    void PopFront() noexcept;
+        if (ptr_next_node == nullptr) {
+            last_node_ = nullptr;
+        }
+        head_.next_node = ptr_next_node;
+        --size_;
+        stats_.OnPopFront();
+    }
 
     /*
      * Удаляет элемент, следующий за pos.
      * Возвращает итератор на элемент, следующий за удалённым
      */
-    Iterator EraseAfter(ConstIterator pos) noexcept;
+    constexpr Iterator EraseAfter(ConstIterator pos) noexcept {
+        assert(pos.node_ != nullptr &&
+               pos.node_ -> next_node != nullptr);
+
+        Node* ptr_node_after_erase = pos.node_ -> next_node -> next_node;
+        DestroyNode(pos.node_ -> next_node);
+
+        pos.node_ -> next_node = ptr_node_after_erase;
+        if (ptr_node_after_erase == nullptr) {
+            last_node_ = pos.node_ == &head_ ? nullptr : pos.node_;
+        }
+        --size_;
+        stats_.OnEraseAfter();
+        return Iterator{ptr_node_after_erase};
+    }
+
+    /*
+     * Переносит все элементы other в позицию после pos за время O(1).
+     * Узлы перецепляются без выделения памяти и копирования,
+     * other становится пустым. Итераторы на элементы other остаются
+     * действительными и указывают на элементы этого списка.
+     * Аллокаторы списков должны быть равны
+     */
+    constexpr void SpliceAfter(ConstIterator pos, SingleLinkedList& other) noexcept {
+        assert(pos.node_ != nullptr && &other != this);
+        assert(alloc_ == other.alloc_);
+        if (other.IsEmpty()) {
+            return;
+        }
+        Node* first = std::exchange(other.head_.next_node, nullptr);
+        Node* last = std::exchange(other.last_node_, nullptr);
+        ++other.version_;
+        LinkAfter(pos.node_, first, last, std::exchange(other.size_, 0));
+    }
+
+    constexpr void SpliceAfter(ConstIterator pos, SingleLinkedList&& other) noexcept {
+        SpliceAfter(pos, other);
+    }
+
+    /*
+     * Переносит элементы other из интервала (first, last) в позицию
+     * после pos. Узлы перецепляются без выделения памяти, но для
+     * поддержания размеров списков интервал проходится целиком,
+     * поэтому время работы линейно от длины интервала.
+     * other может совпадать с этим списком, если pos не лежит внутри
+     * переносимого интервала. Аллокаторы списков должны быть равны
+     */
+    constexpr void SpliceAfter(ConstIterator pos, SingleLinkedList& other,
+                     ConstIterator first, ConstIterator last) noexcept {
+        assert(pos.node_ != nullptr && first.node_ != nullptr);
+        assert(alloc_ == other.alloc_);
+        if (first.node_->next_node == last.node_) {
+            return;
+        }
+        Node* range_first = first.node_->next_node;
+        Node* range_last = range_first;
+        size_t count = 1;
+        while (range_last->next_node != last.node_) {
+            assert(range_last != pos.node_);
+            range_last = range_last->next_node;
+            ++count;
+        }
+        assert(range_last != pos.node_);
+
+        first.node_->next_node = last.node_;
+        if (last.node_ == nullptr) {
+            other.last_node_ =
+                first.node_ == &other.head_ ? nullptr : first.node_;
+        }
+        other.size_ -= count;
+        ++other.version_;
+        range_last->next_node = nullptr;
+        LinkAfter(pos.node_, range_first, range_last, count);
+    }
+
+    constexpr void SpliceAfter(ConstIterator pos, SingleLinkedList&& other,
+                     ConstIterator first, ConstIterator last) noexcept {
+        SpliceAfter(pos, other, first, last);
+    }
+
+    // Переносит все элементы other в конец списка за время O(1)
+    // Аллокаторы списков должны быть равны
+    constexpr void Append(SingleLinkedList&& other) noexcept {
+        SpliceAfter(last_node_ != nullptr ? ConstIterator{last_node_}
+                                          : cbefore_begin(),
+                    other);
+    }
+
+    // Меняет порядок элементов на обратный за время O(N)
+    // Узлы перецепляются, итераторы остаются действительными
+    constexpr void Reverse() noexcept {
+        Node* reversed = nullptr;
+        Node* node = head_.next_node;
+        last_node_ = node;
+        while (node != nullptr) {
+            Node* next = node->next_node;
+            node->next_node = reversed;
+            reversed = node;
+            node = next;
+        }
+        head_.next_node = reversed;
+        ++version_;
+    }
+
+    /*
+     * Сортирует список устойчивой восходящей сортировкой слиянием за
+     * время O(N log N). Узлы только перецепляются: память не
+     * выделяется, элементы не копируются и не перемещаются,
+     * итераторы остаются действительными.
+     * Если comp выбросит исключение, все элементы останутся в
+     * списке, но их порядок не определён
+     */
+    template <typename Compare = std::less<>>
+    constexpr void Sort(Compare comp = Compare()) {
+        if (size_ < 2) {
+            return;
+        }
+        // bins[i] — отсортированная цепочка из 2^i узлов либо nullptr.
+        // Чем больше i, тем раньше в списке стояли узлы цепочки
+        constexpr size_t kMaxBins = sizeof(size_t) * 8;
+        Node* bins[kMaxBins] = {};
+        Node* carry = nullptr;
+        Node* result = nullptr;
+        Node* node = head_.next_node;
+        head_.next_node = nullptr;
+        try {
+            while (node != nullptr) {
+                carry = node;
+                node = node->next_node;
+                carry->next_node = nullptr;
+                size_t i = 0;
+                for (; bins[i] != nullptr; ++i) {
+                    carry = MergeChains(bins[i], carry, comp);
+                }
+                bins[i] = std::exchange(carry, nullptr);
+            }
+            for (Node*& bin : bins) {
+                if (bin != nullptr) {
+                    result = result == nullptr
+                                 ? std::exchange(bin, nullptr)
+                                 : MergeChains(bin, result, comp);
+                }
+            }
+        } catch (...) {
+            // Собираем все цепочки обратно в список, чтобы не
+            // потерять узлы
+            for (Node* chain : bins) {
+                node = PrependChain(chain, node);
+            }
+            node = PrependChain(carry, node);
+            head_.next_node = PrependChain(result, node);
+            RecountNodes();
+            throw;
+        }
+        head_.next_node = result;
+        RecountNodes();
+    }
+
+    /*
+     * Сливает отсортированный по comp список other в этот
+     * отсортированный список за время O(N + M). Слияние устойчиво:
+     * из равных элементов первыми идут элементы этого списка.
+     * Узлы other перецепляются без выделения памяти, other становится
+     * пустым. Аллокаторы списков должны быть равны
+     */
+    template <typename Compare = std::less<>>
+    constexpr void Merge(SingleLinkedList& other, Compare comp = Compare()) {
+        assert(alloc_ == other.alloc_);
+        if (&other == this || other.IsEmpty()) {
+            return;
+        }
+        Node* first = head_.next_node;
+        Node* second = other.head_.next_node;
+        try {
+            head_.next_node = MergeChains(first, second, comp);
+        } catch (...) {
+            // Неслитые узлы остаются в своих списках
+            head_.next_node = first;
+            other.head_.next_node = second;
+            RecountNodes();
+            other.RecountNodes();
+            throw;
+        }
+        // Последним стал последний узел того списка, элементы
+        // которого закончились позже
+        if (last_node_ == nullptr || last_node_->next_node != nullptr) {
+            last_node_ = other.last_node_;
+        }
+        size_ += other.size_;
+        stats_.OnSize(size_);
+        ++version_;
+        other.head_.next_node = nullptr;
+        other.last_node_ = nullptr;
+        other.size_ = 0;
+        ++other.version_;
+    }
+
+    template <typename Compare = std::less<>>
+    constexpr void Merge(SingleLinkedList&& other, Compare comp = Compare()) {
+        Merge(other, comp);
+    }
+
+    /*
+     * Удаляет из каждой группы идущих подряд элементов, для которых
+     * pred(первый элемент группы, элемент) истинно, все элементы,
+     * кроме первого. По умолчанию удаляет подряд идущие дубликаты.
+     * Возвращает количество удалённых элементов
+     */
+    template <typename BinaryPredicate = std::equal_to<>>
+    constexpr size_t Unique(BinaryPredicate pred = BinaryPredicate()) {
+        const size_t old_size = size_;
+        Node* kept = head_.next_node;
+        if (kept == nullptr) {
+            return 0;
+        }
+        while (kept->next_node != nullptr) {
+            Node* candidate = kept->next_node;
+            if (pred(std::as_const(kept->value),
+                     std::as_const(candidate->value))) {
+                kept->next_node = candidate->next_node;
+                DestroyNode(candidate);
+                --size_;
+            } else {
+                kept = candidate;
+            }
+        }
+        last_node_ = kept;
+        return old_size - size_;
+    }
+
+    // Удаляет все элементы, для которых pred истинно, за время O(N)
+    // Возвращает количество удалённых элементов
+    template <typename Predicate>
+    constexpr size_t RemoveIf(Predicate pred) {
+        const size_t old_size = size_;
+        Node* prev = &head_;
+        while (prev->next_node != nullptr) {
+            Node* candidate = prev->next_node;
+            if (pred(std::as_const(candidate->value))) {
+                prev->next_node = candidate->next_node;
+                DestroyNode(candidate);
+                --size_;
+            } else {
+                prev = candidate;
+            }
+        }
+        last_node_ = prev == &head_ ? nullptr : prev;
+        return old_size - size_;
+    }
+
     // Очищает список за время O(N)
-    void Clear() noexcept {
+    constexpr void Clear() noexcept {
         Node* next_node;
         while (head_.next_node != nullptr) {
             next_node = head_.next_node -> next_node;
-            delete head_.next_node;
+            DestroyNode(head_.next_node);
+            head_.next_node = next_node;
+        }
+        size_ = 0;
+        last_node_ = nullptr;
+    }
+
+    /*
+     * Очищает список за время O(N), сохраняя узлы во внутреннем
+     * списке свободных узлов. Последующие вставки используют эти узлы
+     * вместо выделения памяти. Освободить их можно вызовом
+     * ShrinkToFit. При вычислении на этапе компиляции узлы
+     * освобождаются сразу
+     */
+    constexpr void Clear(KeepCapacity) noexcept {
+        if (std::is_constant_evaluated()) {
+            Clear();
+            return;
+        }
+        while (head_.next_node != nullptr) {
+            Node* next_node = head_.next_node->next_node;
+            RecycleNode(head_.next_node);
             head_.next_node = next_node;
         }
         size_ = 0;
+        last_node_ = nullptr;
+    }
+
+    // Возвращает аллокатору память свободных узлов
+    constexpr void ShrinkToFit() noexcept {
+        while (free_nodes_ != nullptr) {
+            DeallocateStorage(TakeFreeNode());
+        }
+    }
+
+    // Возвращает количество элементов, которые можно вставить в
+    // список без выделения памяти, плюс размер списка
+    [[nodiscard]] constexpr size_t GetCapacity() const noexcept {
+        return size_ + free_count_;
+    }
+
+    /*
+     * Задаёт размер кэша узлов: сколько узлов удалённых элементов
+     * список сохраняет для повторного использования вместо
+     * освобождения. В очереди (PushBack и PopFront) кэш из
+     * нескольких узлов убирает выделение памяти полностью. Лишние
+     * свободные узлы освобождаются сразу. По умолчанию, в том числе
+     * у копии списка, кэш выключен. Clear(kKeepCapacity) и Reserve
+     * сохраняют узлы независимо от размера кэша
+     */
+    constexpr void SetNodeCacheSize(size_t size) noexcept {
+        node_cache_size_ = size;
+        while (free_count_ > size) {
+            DeallocateStorage(TakeFreeNode());
+        }
+    }
+
+    // Возвращает размер кэша узлов
+    [[nodiscard]] constexpr size_t GetNodeCacheSize() const noexcept {
+        return node_cache_size_;
+    }
+
+    // Возвращает количество свободных узлов, сохранённых для
+    // повторного использования
+    [[nodiscard]] constexpr size_t GetCachedNodeCount() const noexcept {
+        return free_count_;
+    }
+
+    // Выделяет узлы заранее, чтобы GetCapacity() стала не меньше n,
+    // и увеличивает кэш узлов до n, чтобы удаление элементов не
+    // освобождало выделенное
+    void Reserve(size_t n) {
+        node_cache_size_ = std::max(node_cache_size_, n);
+        while (GetCapacity() < n) {
+            ReleaseStorage(AllocateStorage());
+        }
+    }
+
+    /*
+     * Записывает список в out в формате serialized-list-format.h.
+     * Значения копируются блоками через промежуточный буфер без
+     * преобразований. Ошибки записи отражаются в состоянии out
+     */
+    void Serialize(std::ostream& out) const {
+        const SerializedListHeader header =
+            MakeSerializedListHeader<Type>(size_);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        const char padding[alignof(Type)] = {};
+        out.write(padding,
+                  SerializedListDataOffset<Type>() - sizeof(header));
+
+        alignas(Type) char buffer[kSerializationBufferSize];
+        size_t used = 0;
+        for (const Node* node = head_.next_node; node != nullptr;
+             node = node->next_node) {
+            if (used + sizeof(Type) > sizeof(buffer)) {
+                out.write(buffer, used);
+                used = 0;
+            }
+            std::memcpy(buffer + used, &node->value, sizeof(Type));
+            used += sizeof(Type);
+        }
+        out.write(buffer, used);
+    }
+
+    /*
+     * Читает список, записанный Serialize. Узлы создаются цепочкой
+     * из блоков, прочитанных в промежуточный буфер.
+     * Выбрасывает std::runtime_error, если данные не являются снимком
+     * списка элементов Type или обрываются раньше времени
+     */
+    [[nodiscard]] static SingleLinkedList Deserialize(
+        std::istream& in, const Allocator& alloc = Allocator()) {
+        SerializedListHeader header;
+        ReadExactly(in, reinterpret_cast<char*>(&header), sizeof(header));
+        CheckSerializedListHeader<Type>(header);
+        char padding[alignof(Type)];
+        ReadExactly(in, padding,
+                    SerializedListDataOffset<Type>() - sizeof(header));
+
+        SingleLinkedList list(alloc);
+        alignas(Type) char buffer[kSerializationBufferSize];
+        constexpr size_t kBatch = sizeof(buffer) / sizeof(Type);
+        for (uint64_t left = header.count; left != 0;) {
+            const size_t count =
+                static_cast<size_t>(std::min<uint64_t>(left, kBatch));
+            ReadExactly(in, buffer, count * sizeof(Type));
+            const Type* first =
+                std::launder(reinterpret_cast<const Type*>(buffer));
+            Node* tail =
+                list.last_node_ != nullptr ? list.last_node_ : &list.head_;
+            list.LinkChainAfter(tail, list.CreateChain(first, first + count));
+            left -= count;
+        }
+        return list;
     }
 
-    ~SingleLinkedList();
+    constexpr ~SingleLinkedList() {
+        Clear();
+        ShrinkToFit();
+    }
 
 private:
+    // Размер буфера, через который Serialize и Deserialize передают
+    // значения блоками. Вмещает хотя бы один элемент
+    static constexpr size_t kSerializationBufferSize =
+        std::max<size_t>(16 * 1024, sizeof(Type));
+
+    // Читает из in ровно size байт либо выбрасывает
+    // std::runtime_error
+    static void ReadExactly(std::istream& in, char* data, size_t size) {
+        if (size != 0 &&
+            !in.read(data, static_cast<std::streamsize>(size))) {
+            throw std::runtime_error("truncated serialized list");
+        }
+    }
+
+    // Возвращает политику статистики для копии списка. Выключенная
+    // статистика не имеет состояния и создаётся заново: чтение
+    // mutable-члена недопустимо в константных выражениях
+    static constexpr StatsPolicy CopyStatsPolicy(const StatsPolicy& stats) {
+        if constexpr (StatsPolicy::kEnabled) {
+            return stats;
+        } else {
+            return StatsPolicy();
+        }
+    }
+
+    // Выделяет память под узел аллокатором списка и создаёт в ней
+    // узел со значением, построенным из args. Память берётся из
+    // списка свободных узлов, если он не пуст. Если конструктор
+    // значения выбросит исключение, память будет возвращена туда,
+    // откуда взята
+    template <typename... Args>
+    constexpr Node* CreateNode(Node* next, Args&&... args) {
+        Node* node = TakeFreeNode();
+        const bool recycled = node != nullptr;
+        if (!recycled) {
+            node = AllocateStorage();
+        }
+        try {
+            NodeTraits::construct(alloc_, node, next,
+                                  std::forward<Args>(args)...);
+        } catch (...) {
+            if (recycled) {
+                ReleaseStorage(node);
+            } else {
+                DeallocateStorage(node);
+            }
+            throw;
+        }
+        return node;
+    }
+
+    // Возвращает первый узел со значением value либо nullptr
+    constexpr Node* FindNode(const Type& value) const {
+        Node* node = head_.next_node;
+        while (node != nullptr && !(node->value == value)) {
+            node = node->next_node;
+        }
+        return node;
+    }
+
+    // Выделяет аллокатором списка память под один узел
+    constexpr Node* AllocateStorage() {
+        Node* storage = NodeTraits::allocate(alloc_, 1);
+        stats_.OnNodeAllocate();
+        return storage;
+    }
+
+    // Возвращает аллокатору память узла
+    constexpr void DeallocateStorage(Node* storage) noexcept {
+        NodeTraits::deallocate(alloc_, storage, 1);
+        stats_.OnNodeDeallocate();
+    }
+
+    // Возвращает память свободного узла либо nullptr
+    constexpr Node* TakeFreeNode() noexcept {
+        if (free_nodes_ == nullptr) {
+            return nullptr;
+        }
+        FreeNode* free_node = free_nodes_;
+        free_nodes_ = free_node->next;
+        --free_count_;
+        return reinterpret_cast<Node*>(free_node);
+    }
+
+    // Помещает память разрушенного узла в список свободных
+    void ReleaseStorage(Node* storage) noexcept {
+        free_nodes_ = ::new (static_cast<void*>(storage))
+            FreeNode{free_nodes_};
+        ++free_count_;
+    }
+
+    // Возвращает первый узел участка chunk и узел, следующий за его
+    // последним узлом
+    std::pair<Node*, Node*> ChunkBounds(const ChunkIndex& index,
+                                        size_t chunk) const noexcept {
+        assert(index.IsValidFor(*this));
+        assert(chunk < index.GetChunkCount());
+        Node* last = chunk + 1 < index.starts_.size()
+                         ? index.starts_[chunk + 1]
+                         : nullptr;
+        return {index.starts_[chunk], last};
+    }
+
+    // Запрашивает в кэш память по адресу address, не дожидаясь её
+    static void Prefetch(const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#else
+        static_cast<void>(address);
+#endif
+    }
+
+    // Адрес для предвыборки по умолчанию: памяти вне узла нет
+    struct NoPrefetchAddress {
+        const void* operator()(const Type&) const noexcept {
+            return nullptr;
+        }
+    };
+
+    // Запрашивает в кэш память, которую func прочитает для элемента
+    // узла node
+    template <typename Address>
+    static void PrefetchPayload(Address& address, const Node* node) {
+        if constexpr (!std::is_same_v<Address, NoPrefetchAddress>) {
+            if (const void* payload = address(node->value)) {
+                Prefetch(payload);
+            }
+        }
+    }
+
+    // Кольцевое окно window хранит distance последних найденных
+    // узлов: lead ищет следующий узел, func получает самый старый
+    template <typename ValueType, typename Func, typename Address>
+    void VisitPrefetched(Func& func, Address& address,
+                         size_t distance) const {
+        assert(distance > 0 && distance <= kMaxPrefetchDistance);
+        stats_.OnTraversal();
+        Node* window[kMaxPrefetchDistance];
+        size_t count = 0;
+        Node* lead = head_.next_node;
+        for (; lead != nullptr && count < distance; lead = lead->next_node) {
+            PrefetchPayload(address, lead);
+            window[count++] = lead;
+        }
+        size_t oldest = 0;
+        for (; lead != nullptr; lead = lead->next_node) {
+            PrefetchPayload(address, lead);
+            Node* node = std::exchange(window[oldest], lead);
+            oldest = oldest + 1 == count ? 0 : oldest + 1;
+            stats_.OnTraversalStep();
+            func(static_cast<ValueType&>(node->value));
+        }
+        for (size_t i = 0; i < count; ++i) {
+            stats_.OnTraversalStep();
+            func(static_cast<ValueType&>(window[oldest]->value));
+            oldest = oldest + 1 == count ? 0 : oldest + 1;
+        }
+    }
+
+    template <typename ValueType, typename Func>
+    void VisitBatches(Func& func, size_t batch) const {
+        assert(batch > 0 && batch <= kMaxTraversalBatch);
+        stats_.OnTraversal();
+        ValueType* values[kMaxTraversalBatch];
+        Node* node = head_.next_node;
+        while (node != nullptr) {
+            size_t count = 0;
+            for (; node != nullptr && count < batch; node = node->next_node) {
+                values[count++] = &node->value;
+                stats_.OnTraversalStep();
+            }
+            func(std::span<ValueType* const>(values, count));
+        }
+    }
+
+    // Разрушает значение узла и сохраняет его память для повторного
+    // использования
+    void RecycleNode(Node* node) noexcept {
+        NodeTraits::destroy(alloc_, node);
+        ReleaseStorage(node);
+        ++version_;
+    }
+
+    /*
+     * Перезаписывает значения имеющихся узлов элементами
+     * [first, last). Недостающие узлы создаются цепочкой, лишние
+     * удаляются
+     */
+    template <typename InputIt>
+    constexpr void AssignReusingNodes(InputIt first, InputIt last) {
+        Node* prev = &head_;
+        size_t assigned = 0;
+        for (; prev->next_node != nullptr && first != last; ++first) {
+            prev->next_node->value = *first;
+            prev = prev->next_node;
+            ++assigned;
+        }
+        if (first != last) {
+            LinkChainAfter(prev, CreateChain(first, last));
+            return;
+        }
+        Node* rest = std::exchange(prev->next_node, nullptr);
+        DestroyChain(rest);
+        size_ = assigned;
+        last_node_ = prev == &head_ ? nullptr : prev;
+    }
+
+    // Забирает цепочку узлов other, other становится пустым.
+    // Список должен быть пуст
+    constexpr void StealNodes(SingleLinkedList& other) noexcept {
+        assert(head_.next_node == nullptr);
+        head_.next_node = std::exchange(other.head_.next_node, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        last_node_ = std::exchange(other.last_node_, nullptr);
+        stats_.OnSize(size_);
+        ++version_;
+        ++other.version_;
+    }
+
+    /*
+     * Сливает отсортированные цепочки first и second, завершённые
+     * nullptr. Из равных узлов первыми идут узлы first.
+     * Возвращает голову результата. Если comp выбросит исключение,
+     * узлы обеих цепочек остаются достижимыми из first и second
+     */
+    template <typename Compare>
+    static constexpr Node* MergeChains(Node*& first, Node*& second, Compare& comp) {
+        Node* head = nullptr;
+        Node** link = &head;
+        try {
+            while (first != nullptr && second != nullptr) {
+                Node*& source =
+                    comp(std::as_const(second->value),
+                         std::as_const(first->value)) ? second : first;
+                *link = source;
+                link = &source->next_node;
+                source = source->next_node;
+            }
+        } catch (...) {
+            // Уже слитую часть возвращаем в начало first
+            if (head != nullptr) {
+                *link = first;
+                first = head;
+            }
+            throw;
+        }
+        *link = first != nullptr ? first : second;
+        first = nullptr;
+        second = nullptr;
+        return head;
+    }
+
+    // Присоединяет цепочку rest к концу цепочки chain
+    // Возвращает голову объединённой цепочки
+    static constexpr Node* PrependChain(Node* chain, Node* rest) noexcept {
+        if (chain == nullptr) {
+            return rest;
+        }
+        Node* last = chain;
+        while (last->next_node != nullptr) {
+            last = last->next_node;
+        }
+        last->next_node = rest;
+        return chain;
+    }
+
+    // Пересчитывает size_ и last_node_ обходом цепочки за время O(N)
+    constexpr void RecountNodes() noexcept {
+        ++version_;
+        size_ = 0;
+        last_node_ = nullptr;
+        for (Node* node = head_.next_node; node != nullptr;
+             node = node->next_node) {
+            last_node_ = node;
+            ++size_;
+        }
+    }
+
+    // Создаёт цепочку узлов из элементов [first, last) за один
+    // проход. Если создание элемента выбросит исключение, уже
+    // созданные узлы будут удалены
+    template <typename InputIt, typename Sentinel>
+    constexpr Chain CreateChain(InputIt first, Sentinel last) {
+        Chain chain;
+        Node** link = &chain.first;
+        try {
+            for (; first != last; ++first) {
+                Node* node = CreateNode(nullptr, *first);
+                *link = node;
+                link = &node->next_node;
+                chain.last = node;
+                ++chain.count;
+            }
+        } catch (...) {
+            DestroyChain(chain.first);
+            throw;
+        }
+        return chain;
+    }
+
+    // Удаляет узлы цепочки, начинающейся с node
+    constexpr void DestroyChain(Node* node) noexcept {
+        while (node != nullptr) {
+            Node* next = node->next_node;
+            DestroyNode(node);
+            node = next;
+        }
+    }
+
+    // Вставляет после pos цепочку chain, которая может быть пустой
+    constexpr void LinkChainAfter(Node* pos, const Chain& chain) noexcept {
+        if (chain.count != 0) {
+            LinkAfter(pos, chain.first, chain.last, chain.count);
+        }
+    }
+
+    // Вставляет после pos цепочку из count узлов от first до last
+    // включительно
+    constexpr void LinkAfter(Node* pos, Node* first, Node* last,
+                   size_t count) noexcept {
+        last->next_node = pos->next_node;
+        pos->next_node = first;
+        if (last->next_node == nullptr) {
+            last_node_ = last;
+        }
+        size_ += count;
+        stats_.OnSize(size_);
+        ++version_;
+    }
+
+    // Разрушает узел и сохраняет его память в кэше узлов, если в
+    // нём есть место, иначе возвращает её аллокатору
+    constexpr void DestroyNode(Node* node) noexcept {
+        NodeTraits::destroy(alloc_, node);
+        if (!std::is_constant_evaluated() && free_count_ < node_cache_size_) {
+            ReleaseStorage(node);
+        } else {
+            DeallocateStorage(node);
+        }
+        ++version_;
+    }
+
     // Фиктивный узел, используется для вставки
     // "перед первым элементом"
     Node head_;
     size_t size_ = 0;
     Node* last_node_ = nullptr;
+    [[no_unique_address]] NodeAllocator alloc_;
+    // Список памяти свободных узлов: освобождённых
+    // Clear(kKeepCapacity), выделенных Reserve и сохранённых кэшем
+    FreeNode* free_nodes_ = nullptr;
+    size_t free_count_ = 0;
+    // Наибольшее число свободных узлов, которые сохраняет DestroyNode
+    size_t node_cache_size_ = 0;
+    // Счётчик изменений структуры списка: вставок, удалений, переноса
+    // и перестановки узлов. По нему ChunkIndex узнаёт, что устарел
+    uint64_t version_ = 0;
+    // Статистика принадлежит объекту списка: при обмене и
+    // присваивании она не переносится, а копия и перемещённый список
+    // получают политику, скопированную из исходной (для
+    // CountingListStats это новые счётчики с тем же именем).
+    // mutable, так как обходы константного списка тоже учитываются
+    [[no_unique_address]] mutable StatsPolicy stats_;
 };
 
-template <typename Type>
-void swap(SingleLinkedList<Type>& lhs,
-          SingleLinkedList<Type>& rhs) noexcept {
+template <typename Type, typename Allocator, typename StatsPolicy>
+constexpr void swap(SingleLinkedList<Type, Allocator, StatsPolicy>& lhs,
+          SingleLinkedList<Type, Allocator, StatsPolicy>& rhs) noexcept {
     lhs.swap(rhs);
 }
 
-template <typename Type>
-bool operator==(const SingleLinkedList<Type>& lhs,
-                const SingleLinkedList<Type>& rhs) {
-    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+template <typename Type, typename Allocator, typename StatsPolicy>
+constexpr bool operator==(const SingleLinkedList<Type, Allocator, StatsPolicy>& lhs,
+                const SingleLinkedList<Type, Allocator, StatsPolicy>& rhs) {
+    // Размеры известны за O(1): списки разной длины не обходятся
+    return lhs.GetSize() == rhs.GetSize() &&
+           std::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <typename Type>
-bool operator!=(const SingleLinkedList<Type>& lhs,
-                const SingleLinkedList<Type>& rhs) {
-    if (lhs.GetSize() != rhs.GetSize()) { return true; }
-    auto rhs_it = rhs.begin();
-    for (auto it = lhs.begin(); it != lhs.end(); ++it) {
-        if (*it != *rhs_it) { return true; }
-        ++rhs_it;
-    }
-    return false;
+template <typename Type, typename Allocator, typename StatsPolicy>
+constexpr bool operator!=(const SingleLinkedList<Type, Allocator, StatsPolicy>& lhs,
+                const SingleLinkedList<Type, Allocator, StatsPolicy>& rhs) {
+    return !(lhs == rhs);
 }
 
-template <typename Type>
-bool operator<(const SingleLinkedList<Type>& lhs,
-               const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator, typename StatsPolicy>
+constexpr bool operator<(const SingleLinkedList<Type, Allocator, StatsPolicy>& lhs,
+               const SingleLinkedList<Type, Allocator, StatsPolicy>& rhs) {
     if (std::lexicographical_compare(lhs.begin(), lhs.end(),
                                      rhs.begin(), rhs.end())) {
         return true;
@@ -278,9 +1643,9 @@ bool operator<(const SingleLinkedList<Type>& lhs,
     return false;
 }
 
-template <typename Type>
-bool operator<=(const SingleLinkedList<Type>& lhs,
-                const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator, typename StatsPolicy>
+constexpr bool operator<=(const SingleLinkedList<Type, Allocator, StatsPolicy>& lhs,
+                const SingleLinkedList<Type, Allocator, StatsPolicy>& rhs) {
     if (std::lexicographical_compare(rhs.begin(), rhs.end(),
                                      lhs.begin(), lhs.end())) {
         return false;
@@ -288,9 +1653,9 @@ bool operator<=(const SingleLinkedList<Type>& lhs,
     return true;
 }
 
-template <typename Type>
-bool operator>(const SingleLinkedList<Type>& lhs,
-               const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator, typename StatsPolicy>
+constexpr bool operator>(const SingleLinkedList<Type, Allocator, StatsPolicy>& lhs,
+               const SingleLinkedList<Type, Allocator, StatsPolicy>& rhs) {
     if (std::lexicographical_compare(rhs.begin(), rhs.end(),
                                      lhs.begin(), lhs.end())) {
         return true;
@@ -298,13 +1663,12 @@ bool operator>(const SingleLinkedList<Type>& lhs,
     return false;
 }
 
-template <typename Type>
-bool operator>=(const SingleLinkedList<Type>& lhs,
-                const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator, typename StatsPolicy>
+constexpr bool operator>=(const SingleLinkedList<Type, Allocator, StatsPolicy>& lhs,
+                const SingleLinkedList<Type, Allocator, StatsPolicy>& rhs) {
     if (std::lexicographical_compare(lhs.begin(), lhs.end(),
                                      rhs.begin(), rhs.end())) {
         return false;
     }
     return true;
 }
-
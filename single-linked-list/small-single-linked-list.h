@@ -0,0 +1,475 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Односвязный список с встроенным хранилищем на N узлов.
+ * Первые узлы размещаются в ячейках внутри самого объекта списка,
+ * и только когда все N ячеек заняты, узлы выделяются в куче. Ячейка
+ * освобождается при удалении её элемента и используется следующей
+ * вставкой. Короткий список не выделяет память вовсе.
+ * Интерфейс повторяет SingleLinkedList: before_begin, InsertAfter,
+ * EraseAfter, PopFront и однонаправленные итераторы; вставка и
+ * удаление не делают недействительными итераторы на другие элементы.
+ * Отличие в перемещении и обмене: элементы из встроенных ячеек
+ * переносятся в ячейки другого списка, поэтому итераторы на них
+ * становятся недействительными, и эти операции занимают время O(N).
+ * Поэтому перемещение, обмен и присваивание (копирующее присваивание
+ * сделано через обмен) требуют, чтобы перемещающий конструктор Type
+ * был noexcept: иначе исключение посреди переноса оставило бы часть
+ * элементов в одном списке, а часть в другом. Копирующий конструктор
+ * и остальные операции этого требования не имеют
+ */
+template <typename Type, size_t N = 4>
+class SmallSingleLinkedList {
+    static_assert(N >= 1 && N <= 64,
+                  "inline capacity must be between 1 and 64 nodes");
+
+    // Общая часть узла и фиктивного узла перед первым элементом
+    struct NodeBase {
+        NodeBase* next_node = nullptr;
+    };
+
+    struct Node : NodeBase {
+        // Создаёт значение узла на месте из аргументов args
+        template <typename... Args>
+        explicit Node(NodeBase* next, Args&&... args)
+            : NodeBase{next}
+            , value(std::forward<Args>(args)...) {
+        }
+        Type value;
+    };
+
+    // Битовая маска занятых встроенных ячеек наименьшего подходящего
+    // размера
+    using SlotMask = std::conditional_t<
+        (N <= 8), uint8_t,
+        std::conditional_t<(N <= 16), uint16_t,
+                           std::conditional_t<(N <= 32), uint32_t,
+                                              uint64_t>>>;
+
+    // Шаблон класса «Базовый Итератор».
+    // ValueType — совпадает с Type (для Iterator) либо с
+    // const Type (для ConstIterator)
+    template <typename ValueType>
+    class BasicIterator {
+        friend class SmallSingleLinkedList;
+
+        explicit BasicIterator(NodeBase* node) noexcept
+            : node_(node) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        // Конвертирующий конструктор/конструктор копирования
+        BasicIterator(const BasicIterator<Type>& other) noexcept
+            : node_(other.node_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        [[nodiscard]] bool operator==
+            (const BasicIterator<const Type>& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
+
+        [[nodiscard]] bool operator!=
+            (const BasicIterator<const Type>& rhs) const noexcept {
+            return node_ != rhs.node_;
+        }
+
+        [[nodiscard]] bool operator==
+            (const BasicIterator<Type>& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
+
+        [[nodiscard]] bool operator!=
+            (const BasicIterator<Type>& rhs) const noexcept {
+            return node_ != rhs.node_;
+        }
+
+        BasicIterator& operator++() noexcept {
+            assert(node_ != nullptr);
+            node_ = node_->next_node;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto old_value(*this);
+            ++(*this);
+            return old_value;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(node_ != nullptr);
+            return static_cast<Node*>(node_)->value;
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            return &**this;
+        }
+
+    private:
+        NodeBase* node_ = nullptr;
+    };
+
+public:
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Количество узлов, размещаемых внутри объекта списка
+    static constexpr size_t kInlineCapacity = N;
+
+    SmallSingleLinkedList() = default;
+
+    SmallSingleLinkedList(std::initializer_list<Type> values) {
+        for (const auto& value : values) {
+            PushBack(value);
+        }
+    }
+
+    SmallSingleLinkedList(const SmallSingleLinkedList& other) {
+        for (const auto& value : other) {
+            PushBack(value);
+        }
+    }
+
+    // Перемещающий конструктор. Узлы из кучи other забираются без
+    // копирования, элементы встроенных ячеек перемещаются в ячейки
+    // с теми же номерами
+    SmallSingleLinkedList(SmallSingleLinkedList&& other) noexcept {
+        TakeNodes(other);
+    }
+
+    SmallSingleLinkedList& operator=(const SmallSingleLinkedList& rhs) {
+        if (this != &rhs) {
+            SmallSingleLinkedList tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    SmallSingleLinkedList& operator=(SmallSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            Clear();
+            TakeNodes(rhs);
+        }
+        return *this;
+    }
+
+    ~SmallSingleLinkedList() {
+        Clear();
+    }
+
+    // Обменивает содержимое списков за время O(N)
+    void swap(SmallSingleLinkedList& other) noexcept {
+        SmallSingleLinkedList tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return Iterator{&head_};
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator{const_cast<NodeBase*>(&head_)};
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    [[nodiscard]] Iterator begin() noexcept {
+        return Iterator{head_.next_node};
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator{nullptr};
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator{head_.next_node};
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator{nullptr};
+    }
+
+    // Возвращает количество элементов в списке за время O(1)
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Сообщает, пустой ли список за время O(1)
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Возвращает количество узлов, размещённых в куче
+    [[nodiscard]] size_t GetHeapNodeCount() const noexcept {
+        size_t inline_count = 0;
+        for (SlotMask mask = used_slots_; mask != 0; mask &= mask - 1) {
+            ++inline_count;
+        }
+        return size_ - inline_count;
+    }
+
+    // Вставляет элемент value в начало списка за время O(1)
+    void PushFront(const Type& value) {
+        EmplaceAfter(cbefore_begin(), value);
+    }
+
+    void PushFront(Type&& value) {
+        EmplaceAfter(cbefore_begin(), std::move(value));
+    }
+
+    // Вставляет элемент value в конец списка за время O(1)
+    void PushBack(const Type& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(Type&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    // Создаёт элемент из аргументов args в конце списка за время O(1)
+    // Возвращает ссылку на созданный элемент
+    template <typename... Args>
+    reference EmplaceBack(Args&&... args) {
+        NodeBase* last = last_node_ != nullptr ? last_node_ : &head_;
+        return *EmplaceAfter(ConstIterator{last},
+                             std::forward<Args>(args)...);
+    }
+
+    /*
+     * Вставляет элемент value после элемента, на который указывает
+     * pos. Возвращает итератор на вставленный элемент.
+     * Если при создании элемента будет выброшено исключение,
+     * список останется в прежнем состоянии
+     */
+    Iterator InsertAfter(ConstIterator pos, const Type& value) {
+        return EmplaceAfter(pos, value);
+    }
+
+    Iterator InsertAfter(ConstIterator pos, Type&& value) {
+        return EmplaceAfter(pos, std::move(value));
+    }
+
+    // Создаёт элемент из аргументов args после pos. Узел занимает
+    // свободную встроенную ячейку, а если её нет — выделяется в куче
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
+        assert(pos.node_ != nullptr);
+        Node* node = CreateNode(pos.node_->next_node,
+                                std::forward<Args>(args)...);
+        pos.node_->next_node = node;
+        if (node->next_node == nullptr) {
+            last_node_ = node;
+        }
+        ++size_;
+        return Iterator{node};
+    }
+
+    void PopFront() noexcept {
+        assert(!IsEmpty());
+        EraseAfter(cbefore_begin());
+    }
+
+    /*
+     * Удаляет элемент, следующий за pos.
+     * Возвращает итератор на элемент, следующий за удалённым
+     */
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        assert(pos.node_ != nullptr && pos.node_->next_node != nullptr);
+        Node* erased = static_cast<Node*>(pos.node_->next_node);
+        pos.node_->next_node = erased->next_node;
+        if (pos.node_->next_node == nullptr) {
+            last_node_ = pos.node_ == &head_
+                             ? nullptr
+                             : static_cast<Node*>(pos.node_);
+        }
+        DestroyNode(erased);
+        --size_;
+        return Iterator{pos.node_->next_node};
+    }
+
+    // Очищает список за время O(N)
+    void Clear() noexcept {
+        while (head_.next_node != nullptr) {
+            Node* node = static_cast<Node*>(head_.next_node);
+            head_.next_node = node->next_node;
+            DestroyNode(node);
+        }
+        size_ = 0;
+        last_node_ = nullptr;
+    }
+
+private:
+    // Ячейка встроенного хранилища под один узел
+    struct alignas(Node) Slot {
+        std::byte bytes[sizeof(Node)];
+    };
+
+    Node* SlotNode(size_t index) noexcept {
+        return std::launder(reinterpret_cast<Node*>(slots_[index].bytes));
+    }
+
+    // Возвращает номер встроенной ячейки узла либо N, если узел
+    // выделен в куче. std::less задаёт порядок и для указателей на
+    // разные объекты
+    size_t SlotIndex(const Node* node) const noexcept {
+        const auto* bytes = reinterpret_cast<const std::byte*>(node);
+        const auto* first = slots_[0].bytes;
+        if (std::less<>()(bytes, first) ||
+            !std::less<>()(bytes, first + sizeof(slots_))) {
+            return N;
+        }
+        return static_cast<size_t>(bytes - first) / sizeof(Slot);
+    }
+
+    template <typename... Args>
+    Node* CreateNode(NodeBase* next, Args&&... args) {
+        const SlotMask free_slots =
+            static_cast<SlotMask>(~used_slots_ & kAllSlots);
+        if (free_slots == 0) {
+            return new Node(next, std::forward<Args>(args)...);
+        }
+        const auto slot_bit =
+            static_cast<SlotMask>(free_slots & (0 - free_slots));
+        size_t index = 0;
+        while ((SlotMask{1} << index) != slot_bit) {
+            ++index;
+        }
+        Node* node = ::new (slots_[index].bytes)
+            Node(next, std::forward<Args>(args)...);
+        used_slots_ |= slot_bit;
+        return node;
+    }
+
+    void DestroyNode(Node* node) noexcept {
+        const size_t index = SlotIndex(node);
+        if (index == N) {
+            delete node;
+        } else {
+            node->~Node();
+            used_slots_ &= static_cast<SlotMask>(~(SlotMask{1} << index));
+        }
+    }
+
+    /*
+     * Забирает элементы other в пустой список, other становится
+     * пустым. Узлы из кучи перецепляются, элементы встроенных ячеек
+     * перемещаются в ячейки с теми же номерами
+     */
+    void TakeNodes(SmallSingleLinkedList& other) noexcept {
+        static_assert(std::is_nothrow_move_constructible_v<Type>,
+                      "moving a small list requires a noexcept move of "
+                      "its elements");
+        assert(IsEmpty());
+        NodeBase* prev = &head_;
+        for (NodeBase* base = other.head_.next_node; base != nullptr;) {
+            Node* node = static_cast<Node*>(base);
+            base = node->next_node;
+            const size_t index = other.SlotIndex(node);
+            if (index != N) {
+                Node* moved = ::new (slots_[index].bytes)
+                    Node(nullptr, std::move(node->value));
+                node->~Node();
+                node = moved;
+            }
+            prev->next_node = node;
+            prev = node;
+        }
+        prev->next_node = nullptr;
+        last_node_ = prev == &head_ ? nullptr : static_cast<Node*>(prev);
+        size_ = std::exchange(other.size_, 0);
+        used_slots_ = std::exchange(other.used_slots_, 0);
+        other.head_.next_node = nullptr;
+        other.last_node_ = nullptr;
+    }
+
+    static constexpr SlotMask kAllSlots =
+        static_cast<SlotMask>(N == 64 ? ~uint64_t{0}
+                                      : (uint64_t{1} << (N % 64)) - 1);
+
+    // Фиктивный узел, используется для вставки
+    // "перед первым элементом"
+    NodeBase head_;
+    Node* last_node_ = nullptr;
+    size_t size_ = 0;
+    SlotMask used_slots_ = 0;
+    Slot slots_[N];
+};
+
+template <typename Type, size_t N>
+void swap(SmallSingleLinkedList<Type, N>& lhs,
+          SmallSingleLinkedList<Type, N>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type, size_t N>
+bool operator==(const SmallSingleLinkedList<Type, N>& lhs,
+                const SmallSingleLinkedList<Type, N>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() &&
+           std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type, size_t N>
+bool operator!=(const SmallSingleLinkedList<Type, N>& lhs,
+                const SmallSingleLinkedList<Type, N>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t N>
+bool operator<(const SmallSingleLinkedList<Type, N>& lhs,
+               const SmallSingleLinkedList<Type, N>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(),
+                                        rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t N>
+bool operator<=(const SmallSingleLinkedList<Type, N>& lhs,
+                const SmallSingleLinkedList<Type, N>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type, size_t N>
+bool operator>(const SmallSingleLinkedList<Type, N>& lhs,
+               const SmallSingleLinkedList<Type, N>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type, size_t N>
+bool operator>=(const SmallSingleLinkedList<Type, N>& lhs,
+                const SmallSingleLinkedList<Type, N>& rhs) {
+    return !(lhs < rhs);
+}
@@ -0,0 +1,438 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "single-linked-list.h"
+
+/*
+ * Отсортированный односвязный список с индексом в виде списка с
+ * пропусками (skip list).
+ * Элементы хранятся в обычной цепочке SingleLinkedList в порядке
+ * comp, равные — в порядке вставки. Над цепочкой лежат уровни
+ * индекса: примерно каждый четвёртый элемент получает «башню»
+ * ссылок вперёд, каждая следующая её ступень встречается в четыре
+ * раза реже. Поиск спускается по уровням и доходит до цепочки рядом с
+ * нужной позицией, поэтому Insert, Find, LowerBound и Erase
+ * выполняются в среднем за O(log N), а begin()/end() обходят
+ * цепочку как обычный список.
+ * Элементы доступны только для чтения: изменение значения нарушило
+ * бы порядок
+ */
+template <typename Type, typename Compare = std::less<Type>>
+class SortedSingleLinkedList {
+    using List = SingleLinkedList<Type>;
+
+public:
+    using value_type = Type;
+    using const_reference = const value_type&;
+    using ConstIterator = typename List::ConstIterator;
+    using Iterator = ConstIterator;
+    using Range = std::ranges::subrange<ConstIterator>;
+
+    // Наибольшая высота башни индекса
+    static constexpr size_t kMaxLevel = 16;
+
+    SortedSingleLinkedList() = default;
+
+    explicit SortedSingleLinkedList(const Compare& comp)
+        : comp_(comp) {
+    }
+
+    // Создаёт список из элементов диапазона [first, last). Элементы
+    // сортируются, после чего индекс строится за один проход, поэтому
+    // время работы O(N log N) без поиска позиции для каждого элемента
+    template <typename InputIt>
+    SortedSingleLinkedList(InputIt first, InputIt last,
+                           const Compare& comp = Compare())
+        : comp_(comp) {
+        std::vector<Type> sorted(first, last);
+        std::stable_sort(sorted.begin(), sorted.end(), comp_);
+        list_.Assign(sorted.begin(), sorted.end());
+        BuildIndex();
+    }
+
+    SortedSingleLinkedList(std::initializer_list<Type> values,
+                           const Compare& comp = Compare())
+        : SortedSingleLinkedList(values.begin(), values.end(), comp) {
+    }
+
+    SortedSingleLinkedList(const SortedSingleLinkedList& other)
+        : list_(other.list_)
+        , comp_(other.comp_) {
+        BuildIndex();
+    }
+
+    // Башни ссылаются на узлы цепочки, которые при перемещении
+    // остаются на месте, поэтому индекс переходит целиком
+    SortedSingleLinkedList(SortedSingleLinkedList&& other) noexcept
+        : list_(std::move(other.list_))
+        , comp_(other.comp_)
+        , level_(std::exchange(other.level_, 0))
+        , random_state_(other.random_state_) {
+        std::copy(std::begin(other.head_), std::end(other.head_),
+                  std::begin(head_));
+        std::fill(std::begin(other.head_), std::end(other.head_), nullptr);
+    }
+
+    SortedSingleLinkedList& operator=(const SortedSingleLinkedList& rhs) {
+        if (this != &rhs) {
+            SortedSingleLinkedList tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    SortedSingleLinkedList& operator=(SortedSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            SortedSingleLinkedList tmp(std::move(rhs));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    ~SortedSingleLinkedList() {
+        DestroyIndex();
+    }
+
+    // Обменивает содержимое списков за время O(1)
+    void swap(SortedSingleLinkedList& other) noexcept {
+        using std::swap;
+        list_.swap(other.list_);
+        swap(comp_, other.comp_);
+        swap(head_, other.head_);
+        swap(level_, other.level_);
+        swap(random_state_, other.random_state_);
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return list_.before_begin();
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return list_.begin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return list_.end();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return list_.cbegin();
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return list_.cend();
+    }
+
+    // Возвращает количество элементов за время O(1)
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return list_.GetSize();
+    }
+
+    // Сообщает, пустой ли список, за время O(1)
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return list_.IsEmpty();
+    }
+
+    // Возвращает итератор на первый элемент, не меньший value
+    [[nodiscard]] ConstIterator LowerBound(const Type& value) const {
+        return std::next(FindBefore(value, nullptr));
+    }
+
+    // Возвращает итератор на первый элемент, больший value
+    [[nodiscard]] ConstIterator UpperBound(const Type& value) const {
+        return std::next(FindBeforeUpper(value, nullptr));
+    }
+
+    // Возвращает итератор на первый элемент, равный value, либо end()
+    [[nodiscard]] ConstIterator Find(const Type& value) const {
+        const ConstIterator it = LowerBound(value);
+        return it != end() && !comp_(value, *it) ? it : end();
+    }
+
+    [[nodiscard]] bool Contains(const Type& value) const {
+        return Find(value) != end();
+    }
+
+    // Возвращает элементы из полуинтервала [low, high) в порядке
+    // возрастания. Начало диапазона находится за O(log N), конец —
+    // тоже, а обход идёт по цепочке
+    [[nodiscard]] Range GetRange(const Type& low, const Type& high) const {
+        if (!comp_(low, high)) {
+            return Range(end(), end());
+        }
+        return Range(LowerBound(low), LowerBound(high));
+    }
+
+    /*
+     * Вставляет value после равных ему элементов за время O(log N)
+     * в среднем. Возвращает итератор на вставленный элемент.
+     * Если при создании элемента будет выброшено исключение, список
+     * останется в прежнем состоянии
+     */
+    ConstIterator Insert(const Type& value) {
+        return InsertAt(value, value);
+    }
+
+    ConstIterator Insert(Type&& value) {
+        return InsertAt(value, std::move(value));
+    }
+
+    // Позицию ищут по готовому значению, поэтому элемент создаётся
+    // заранее и перемещается в узел цепочки
+    template <typename... Args>
+    ConstIterator Emplace(Args&&... args) {
+        Type value(std::forward<Args>(args)...);
+        return InsertAt(value, std::move(value));
+    }
+
+    // Удаляет первый элемент, равный value, за время O(log N) в
+    // среднем. Возвращает false, если такого элемента нет
+    bool Erase(const Type& value) {
+        Tower** links[kMaxLevel];
+        const ConstIterator prev = FindBefore(value, links);
+        const ConstIterator target = std::next(prev);
+        if (target == end() || comp_(value, *target)) {
+            return false;
+        }
+        EraseAfter(prev, links);
+        return true;
+    }
+
+    // Удаляет первый элемент за время O(1)
+    void PopFront() noexcept {
+        assert(!IsEmpty());
+        Tower** links[kMaxLevel];
+        for (size_t level = 0; level < level_; ++level) {
+            links[level] = &head_[level];
+        }
+        EraseAfter(list_.cbefore_begin(), links);
+    }
+
+    // Удаляет все элементы и индекс за время O(N)
+    void Clear() noexcept {
+        DestroyIndex();
+        list_.Clear();
+    }
+
+private:
+    // Башня индекса над узлом цепочки. Ссылки уровней лежат в том же
+    // блоке памяти сразу за заголовком
+    struct Tower {
+        ConstIterator node;
+        size_t height;
+        Tower** next;
+    };
+
+    static Tower* CreateTower(size_t height) {
+        void* memory =
+            ::operator new(sizeof(Tower) + height * sizeof(Tower*));
+        Tower** next = reinterpret_cast<Tower**>(
+            static_cast<char*>(memory) + sizeof(Tower));
+        std::fill(next, next + height, nullptr);
+        return ::new (memory) Tower{ConstIterator{}, height, next};
+    }
+
+    static void DestroyTower(Tower* tower) noexcept {
+        tower->~Tower();
+        ::operator delete(tower);
+    }
+
+    // Башня случайной высоты для нового элемента либо nullptr, если
+    // элемент не попадает в индекс
+    Tower* CreateRandomTower() {
+        const size_t height = RandomHeight();
+        return height > 0 ? CreateTower(height) : nullptr;
+    }
+
+    // Вставляет элемент, созданный из arg, после равных value. Узел
+    // создаётся сразу в цепочке, позиция ищется по value
+    template <typename Arg>
+    ConstIterator InsertAt(const Type& value, Arg&& arg) {
+        Tower** links[kMaxLevel];
+        const ConstIterator prev = FindBeforeUpper(value, links);
+        Tower* tower = CreateRandomTower();
+
+        ConstIterator inserted;
+        try {
+            inserted = list_.EmplaceAfter(prev, std::forward<Arg>(arg));
+        } catch (...) {
+            if (tower != nullptr) {
+                DestroyTower(tower);
+            }
+            throw;
+        }
+        LinkTower(tower, inserted, links);
+        return inserted;
+    }
+
+    // Ставит tower над узлом inserted. links — ссылки, найденные
+    // поиском позиции узла
+    void LinkTower(Tower* tower, ConstIterator inserted,
+                   Tower** links[]) noexcept {
+        if (tower == nullptr) {
+            return;
+        }
+        tower->node = inserted;
+        for (size_t level = level_; level < tower->height; ++level) {
+            links[level] = &head_[level];
+        }
+        level_ = std::max(level_, tower->height);
+        for (size_t level = 0; level < tower->height; ++level) {
+            tower->next[level] = *links[level];
+            *links[level] = tower;
+        }
+    }
+
+    /*
+     * Возвращает итератор на последний элемент, меньший value (либо
+     * before_begin()). Если links не равен nullptr, в links[level]
+     * записывается адрес ссылки уровня level, после которой стоит
+     * искомая позиция
+     */
+    ConstIterator FindBefore(const Type& value, Tower*** links) const {
+        return Descend(links, [this, &value](const Type& element) {
+            return comp_(element, value);
+        });
+    }
+
+    // То же для последнего элемента, не большего value
+    ConstIterator FindBeforeUpper(const Type& value, Tower*** links) const {
+        return Descend(links, [this, &value](const Type& element) {
+            return !comp_(value, element);
+        });
+    }
+
+    // Спускается по уровням индекса, переходя вперёд, пока элемент
+    // следующей башни удовлетворяет before, затем доходит по цепочке
+    template <typename Before>
+    ConstIterator Descend(Tower*** links, Before before) const {
+        ConstIterator prev = list_.cbefore_begin();
+        Tower* const* next = head_;
+        for (size_t level = level_; level-- > 0;) {
+            while (next[level] != nullptr && before(*next[level]->node)) {
+                prev = next[level]->node;
+                next = next[level]->next;
+            }
+            if (links != nullptr) {
+                links[level] = const_cast<Tower**>(&next[level]);
+            }
+        }
+        for (ConstIterator it = std::next(prev); it != end() && before(*it);
+             ++it) {
+            prev = it;
+        }
+        return prev;
+    }
+
+    // Удаляет элемент после prev и его башню. links — ссылки,
+    // найденные поиском позиции элемента
+    void EraseAfter(ConstIterator prev, Tower** links[]) noexcept {
+        const ConstIterator target = std::next(prev);
+        Tower* tower = level_ > 0 ? *links[0] : nullptr;
+        if (tower != nullptr && tower->node == target) {
+            for (size_t level = 0; level < tower->height; ++level) {
+                *links[level] = tower->next[level];
+            }
+            DestroyTower(tower);
+            while (level_ > 0 && head_[level_ - 1] == nullptr) {
+                --level_;
+            }
+        }
+        list_.EraseAfter(prev);
+    }
+
+    // Высота башни для нового элемента: 0 с вероятностью 3/4, и
+    // каждая следующая ступень — с вероятностью 1/4
+    size_t RandomHeight() noexcept {
+        // xorshift64
+        random_state_ ^= random_state_ << 13;
+        random_state_ ^= random_state_ >> 7;
+        random_state_ ^= random_state_ << 17;
+        uint64_t bits = random_state_;
+        size_t height = 0;
+        while ((bits & 3) == 0 && height < kMaxLevel) {
+            ++height;
+            bits >>= 2;
+        }
+        return height;
+    }
+
+    // Строит индекс над цепочкой за один проход. Если выделение
+    // башни выбросит исключение, уже построенные башни освобождаются:
+    // в конструкторе деструктор за них этого не сделает
+    void BuildIndex() {
+        DestroyIndex();
+        Tower** tails[kMaxLevel];
+        for (size_t level = 0; level < kMaxLevel; ++level) {
+            tails[level] = &head_[level];
+        }
+        try {
+            for (ConstIterator it = list_.cbegin(); it != list_.cend();
+                 ++it) {
+                const size_t height = RandomHeight();
+                if (height == 0) {
+                    continue;
+                }
+                Tower* tower = CreateTower(height);
+                tower->node = it;
+                for (size_t level = 0; level < height; ++level) {
+                    *tails[level] = tower;
+                    tails[level] = &tower->next[level];
+                }
+                level_ = std::max(level_, height);
+            }
+        } catch (...) {
+            DestroyIndex();
+            throw;
+        }
+    }
+
+    void DestroyIndex() noexcept {
+        Tower* tower = level_ > 0 ? head_[0] : nullptr;
+        while (tower != nullptr) {
+            Tower* next = tower->next[0];
+            DestroyTower(tower);
+            tower = next;
+        }
+        std::fill(std::begin(head_), std::end(head_), nullptr);
+        level_ = 0;
+    }
+
+    List list_;
+    [[no_unique_address]] Compare comp_;
+    // Первые башни каждого уровня
+    Tower* head_[kMaxLevel] = {};
+    // Число непустых уровней индекса
+    size_t level_ = 0;
+    uint64_t random_state_ = 0x9E3779B97F4A7C15ull;
+};
+
+template <typename Type, typename Compare>
+void swap(SortedSingleLinkedList<Type, Compare>& lhs,
+          SortedSingleLinkedList<Type, Compare>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type, typename Compare>
+bool operator==(const SortedSingleLinkedList<Type, Compare>& lhs,
+                const SortedSingleLinkedList<Type, Compare>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() &&
+           std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type, typename Compare>
+bool operator!=(const SortedSingleLinkedList<Type, Compare>& lhs,
+                const SortedSingleLinkedList<Type, Compare>& rhs) {
+    return !(lhs == rhs);
+}
@@ -0,0 +1,355 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Односвязный список фиксированной вместимости N без выделения
+ * памяти. Узлы лежат в std::array внутри объекта и связаны номерами,
+ * а не указателями, поэтому список можно копировать побайтово и
+ * целиком построить на этапе компиляции:
+ *
+ *     constexpr StaticSingleLinkedList<int, 4> kPrimes{2, 3, 5, 7};
+ *
+ * Такая переменная размещается в данных только для чтения и не
+ * требует работы при запуске программы. Все операции constexpr.
+ * Интерфейс повторяет SingleLinkedList: before_begin, InsertAfter,
+ * EraseAfter, PopFront и однонаправленные итераторы. Вставка в
+ * заполненный список выбрасывает std::length_error, а при
+ * вычислении на этапе компиляции приводит к ошибке компиляции.
+ * Type должен иметь конструктор по умолчанию: им заполняются
+ * свободные узлы
+ */
+template <typename Type, size_t N>
+class StaticSingleLinkedList {
+    // Номер фиктивного узла перед первым элементом
+    static constexpr size_t kHead = N;
+    // Номер, означающий отсутствие следующего узла
+    static constexpr size_t kNone = N + 1;
+
+    struct Node {
+        Type value{};
+        size_t next = kNone;
+    };
+
+    // Шаблон класса «Базовый Итератор».
+    // Итератор хранит список и номер узла в нём
+    // ValueType — совпадает с Type (для Iterator) либо с
+    // const Type (для ConstIterator)
+    template <typename ValueType>
+    class BasicIterator {
+        friend class StaticSingleLinkedList;
+
+        using List = std::conditional_t<std::is_const_v<ValueType>,
+                                        const StaticSingleLinkedList,
+                                        StaticSingleLinkedList>;
+
+        constexpr BasicIterator(List* list, size_t index) noexcept
+            : list_(list)
+            , index_(index) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        // Конвертирующий конструктор/конструктор копирования
+        constexpr BasicIterator(const BasicIterator<Type>& other) noexcept
+            : list_(other.list_)
+            , index_(other.index_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        // Итераторы end() всех списков равны, поэтому сравнивается
+        // только номер узла
+        [[nodiscard]] constexpr bool operator==
+            (const BasicIterator<const Type>& rhs) const noexcept {
+            return index_ == rhs.index_;
+        }
+
+        [[nodiscard]] constexpr bool operator!=
+            (const BasicIterator<const Type>& rhs) const noexcept {
+            return index_ != rhs.index_;
+        }
+
+        [[nodiscard]] constexpr bool operator==
+            (const BasicIterator<Type>& rhs) const noexcept {
+            return index_ == rhs.index_;
+        }
+
+        [[nodiscard]] constexpr bool operator!=
+            (const BasicIterator<Type>& rhs) const noexcept {
+            return index_ != rhs.index_;
+        }
+
+        constexpr BasicIterator& operator++() noexcept {
+            assert(index_ != kNone);
+            index_ = list_->nodes_[index_].next;
+            return *this;
+        }
+
+        constexpr BasicIterator operator++(int) noexcept {
+            auto old_value(*this);
+            ++(*this);
+            return old_value;
+        }
+
+        [[nodiscard]] constexpr reference operator*() const noexcept {
+            assert(index_ < N);
+            return list_->nodes_[index_].value;
+        }
+
+        [[nodiscard]] constexpr pointer operator->() const noexcept {
+            return &**this;
+        }
+
+    private:
+        List* list_ = nullptr;
+        size_t index_ = kNone;
+    };
+
+public:
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    constexpr StaticSingleLinkedList() = default;
+
+    constexpr StaticSingleLinkedList(std::initializer_list<Type> values) {
+        for (const auto& value : values) {
+            PushBack(value);
+        }
+    }
+
+    [[nodiscard]] constexpr Iterator before_begin() noexcept {
+        return Iterator{this, kHead};
+    }
+
+    [[nodiscard]] constexpr ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator{this, kHead};
+    }
+
+    [[nodiscard]] constexpr ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    [[nodiscard]] constexpr Iterator begin() noexcept {
+        return Iterator{this, nodes_[kHead].next};
+    }
+
+    [[nodiscard]] constexpr Iterator end() noexcept {
+        return Iterator{this, kNone};
+    }
+
+    [[nodiscard]] constexpr ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] constexpr ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] constexpr ConstIterator cbegin() const noexcept {
+        return ConstIterator{this, nodes_[kHead].next};
+    }
+
+    [[nodiscard]] constexpr ConstIterator cend() const noexcept {
+        return ConstIterator{this, kNone};
+    }
+
+    // Возвращает количество элементов в списке за время O(1)
+    [[nodiscard]] constexpr size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Сообщает, пустой ли список за время O(1)
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Возвращает наибольшее количество элементов в списке
+    [[nodiscard]] static constexpr size_t GetCapacity() noexcept {
+        return N;
+    }
+
+    // Сообщает, заполнен ли список
+    [[nodiscard]] constexpr bool IsFull() const noexcept {
+        return size_ == N;
+    }
+
+    // Возвращает итератор на первый элемент, равный value, либо end()
+    [[nodiscard]] constexpr Iterator Find(const Type& value) {
+        return Iterator{this, FindIndex(value)};
+    }
+
+    [[nodiscard]] constexpr ConstIterator Find(const Type& value) const {
+        return ConstIterator{this, FindIndex(value)};
+    }
+
+    // Сообщает, есть ли в списке элемент, равный value
+    [[nodiscard]] constexpr bool Contains(const Type& value) const {
+        return FindIndex(value) != kNone;
+    }
+
+    // Вставляет элемент value в начало списка за время O(1)
+    constexpr void PushFront(const Type& value) {
+        InsertAfter(cbefore_begin(), value);
+    }
+
+    constexpr void PushFront(Type&& value) {
+        InsertAfter(cbefore_begin(), std::move(value));
+    }
+
+    // Вставляет элемент value в конец списка за время O(1)
+    constexpr void PushBack(const Type& value) {
+        InsertAfter(ConstIterator{this, last_}, value);
+    }
+
+    constexpr void PushBack(Type&& value) {
+        InsertAfter(ConstIterator{this, last_}, std::move(value));
+    }
+
+    /*
+     * Вставляет элемент value после элемента, на который указывает
+     * pos. Возвращает итератор на вставленный элемент.
+     * Если список заполнен, выбрасывает std::length_error
+     */
+    constexpr Iterator InsertAfter(ConstIterator pos, const Type& value) {
+        return LinkAfter(pos, Type(value));
+    }
+
+    constexpr Iterator InsertAfter(ConstIterator pos, Type&& value) {
+        return LinkAfter(pos, std::move(value));
+    }
+
+    constexpr void PopFront() noexcept {
+        assert(!IsEmpty());
+        EraseAfter(cbefore_begin());
+    }
+
+    /*
+     * Удаляет элемент, следующий за pos.
+     * Возвращает итератор на элемент, следующий за удалённым
+     */
+    constexpr Iterator EraseAfter(ConstIterator pos) noexcept {
+        assert(pos.list_ == this && pos.index_ != kNone);
+        const size_t erased = nodes_[pos.index_].next;
+        assert(erased != kNone);
+        nodes_[pos.index_].next = nodes_[erased].next;
+        if (nodes_[pos.index_].next == kNone) {
+            last_ = pos.index_;
+        }
+        // Узел возвращается в список свободных, а значение
+        // сбрасывается, чтобы освободить его ресурсы
+        nodes_[erased].value = Type();
+        nodes_[erased].next = free_;
+        free_ = erased;
+        --size_;
+        return Iterator{this, nodes_[pos.index_].next};
+    }
+
+    // Очищает список за время O(N)
+    constexpr void Clear() noexcept {
+        while (!IsEmpty()) {
+            PopFront();
+        }
+    }
+
+private:
+    constexpr size_t FindIndex(const Type& value) const {
+        size_t index = nodes_[kHead].next;
+        while (index != kNone && !(nodes_[index].value == value)) {
+            index = nodes_[index].next;
+        }
+        return index;
+    }
+
+    // Помещает value в свободный узел и вставляет его после pos.
+    // Свободные узлы сначала берутся из удалённых, затем из ещё не
+    // использованных
+    constexpr Iterator LinkAfter(ConstIterator pos, Type&& value) {
+        assert(pos.list_ == this && pos.index_ != kNone);
+        if (IsFull()) {
+            throw std::length_error("StaticSingleLinkedList is full");
+        }
+        size_t index = free_;
+        if (index != kNone) {
+            free_ = nodes_[index].next;
+        } else {
+            index = used_++;
+        }
+        nodes_[index].value = std::move(value);
+        nodes_[index].next = nodes_[pos.index_].next;
+        nodes_[pos.index_].next = index;
+        if (nodes_[index].next == kNone) {
+            last_ = index;
+        }
+        ++size_;
+        return Iterator{this, index};
+    }
+
+    // Узлы 0..N-1 хранят элементы, узел kHead — фиктивный узел
+    // перед первым элементом
+    std::array<Node, N + 1> nodes_{};
+    size_t size_ = 0;
+    // Последний узел списка либо kHead для пустого списка
+    size_t last_ = kHead;
+    // Начало списка свободных узлов, освобождённых EraseAfter
+    size_t free_ = kNone;
+    // Количество узлов, хотя бы раз выданных под элементы
+    size_t used_ = 0;
+};
+
+template <typename Type, size_t N>
+constexpr bool operator==(const StaticSingleLinkedList<Type, N>& lhs,
+                          const StaticSingleLinkedList<Type, N>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() &&
+           std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type, size_t N>
+constexpr bool operator!=(const StaticSingleLinkedList<Type, N>& lhs,
+                          const StaticSingleLinkedList<Type, N>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t N>
+constexpr bool operator<(const StaticSingleLinkedList<Type, N>& lhs,
+                         const StaticSingleLinkedList<Type, N>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(),
+                                        rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t N>
+constexpr bool operator<=(const StaticSingleLinkedList<Type, N>& lhs,
+                          const StaticSingleLinkedList<Type, N>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type, size_t N>
+constexpr bool operator>(const StaticSingleLinkedList<Type, N>& lhs,
+                         const StaticSingleLinkedList<Type, N>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type, size_t N>
+constexpr bool operator>=(const StaticSingleLinkedList<Type, N>& lhs,
+                          const StaticSingleLinkedList<Type, N>& rhs) {
+    return !(lhs < rhs);
+}
@@ -0,0 +1,608 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "simd-kernels.h"
+
+/*
+ * Развёрнутый односвязный список: каждый узел хранит до N элементов
+ * во встроенном массиве. При обходе один переход по указателю
+ * приходится на N элементов, а соседние элементы лежат в памяти
+ * подряд.
+ * Интерфейс повторяет SingleLinkedList: before_begin, InsertAfter,
+ * EraseAfter, PopFront и однонаправленные итераторы. Отличие в
+ * инвалидации: вставка и удаление сдвигают элементы внутри узла,
+ * поэтому делают недействительными итераторы на элементы этого узла
+ * (а при разделении переполненного узла — и на перенесённые
+ * элементы). Итераторы на элементы других узлов остаются
+ * действительными.
+ * Строгая гарантия безопасности исключений при вставке
+ * обеспечивается, если перемещение Type не выбрасывает исключений.
+ * В любом случае исключение из конструктора Type не приводит к
+ * утечке узлов
+ */
+template <typename Type, size_t N = 16>
+class UnrolledSingleLinkedList {
+    static_assert(N >= 2, "an unrolled node must hold at least 2 elements");
+
+    // Общая часть узла и фиктивного узла перед первым элементом
+    struct NodeBase {
+        NodeBase* next_node = nullptr;
+        size_t count = 0;
+    };
+
+    // Узел списка: до N элементов в неинициализированном массиве,
+    // занятыми являются первые count ячеек
+    struct Node : NodeBase {
+        Type* Values() noexcept {
+            return std::launder(reinterpret_cast<Type*>(storage));
+        }
+        alignas(Type) std::byte storage[sizeof(Type) * N];
+    };
+
+    // Шаблон класса «Базовый Итератор».
+    // Итератор хранит узел и номер элемента внутри узла
+    // ValueType — совпадает с Type (для Iterator) либо с
+    // const Type (для ConstIterator)
+    template <typename ValueType>
+    class BasicIterator {
+        friend class UnrolledSingleLinkedList;
+
+        BasicIterator(NodeBase* node, size_t index) noexcept
+            : node_(node)
+            , index_(index) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        // Конвертирующий конструктор/конструктор копирования
+        BasicIterator(const BasicIterator<Type>& other) noexcept
+            : node_(other.node_)
+            , index_(other.index_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        [[nodiscard]] bool operator==
+            (const BasicIterator<const Type>& rhs) const noexcept {
+            return node_ == rhs.node_ && index_ == rhs.index_;
+        }
+
+        [[nodiscard]] bool operator!=
+            (const BasicIterator<const Type>& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
+        [[nodiscard]] bool operator==
+            (const BasicIterator<Type>& rhs) const noexcept {
+            return node_ == rhs.node_ && index_ == rhs.index_;
+        }
+
+        [[nodiscard]] bool operator!=
+            (const BasicIterator<Type>& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
+        // Переходит к следующему элементу узла, а после последнего
+        // элемента — к первому элементу следующего узла
+        BasicIterator& operator++() noexcept {
+            assert(node_ != nullptr);
+            if (index_ + 1 < node_->count) {
+                ++index_;
+            } else {
+                node_ = node_->next_node;
+                index_ = 0;
+            }
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto old_value(*this);
+            ++(*this);
+            return old_value;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(node_ != nullptr && index_ < node_->count);
+            return static_cast<Node*>(node_)->Values()[index_];
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            return &**this;
+        }
+
+    private:
+        NodeBase* node_ = nullptr;
+        size_t index_ = 0;
+    };
+
+public:
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Максимальное количество элементов в одном узле
+    static constexpr size_t kNodeCapacity = N;
+
+    UnrolledSingleLinkedList() = default;
+
+    UnrolledSingleLinkedList(std::initializer_list<Type> values) {
+        for (const auto& value : values) {
+            PushBack(value);
+        }
+    }
+
+    UnrolledSingleLinkedList(const UnrolledSingleLinkedList& other) {
+        for (const auto& value : other) {
+            PushBack(value);
+        }
+    }
+
+    UnrolledSingleLinkedList(UnrolledSingleLinkedList&& other) noexcept {
+        swap(other);
+    }
+
+    UnrolledSingleLinkedList& operator=(
+        const UnrolledSingleLinkedList& rhs) {
+        if (this != &rhs) {
+            UnrolledSingleLinkedList tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    UnrolledSingleLinkedList& operator=(
+        UnrolledSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            Clear();
+            swap(rhs);
+        }
+        return *this;
+    }
+
+    ~UnrolledSingleLinkedList() {
+        Clear();
+    }
+
+    // Обменивает содержимое списков за время O(1)
+    void swap(UnrolledSingleLinkedList& other) noexcept {
+        std::swap(head_.next_node, other.head_.next_node);
+        std::swap(size_, other.size_);
+        std::swap(last_node_, other.last_node_);
+    }
+
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return Iterator{&head_, 0};
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator{const_cast<NodeBase*>(&head_), 0};
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    [[nodiscard]] Iterator begin() noexcept {
+        return Iterator{head_.next_node, 0};
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator{nullptr, 0};
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator{head_.next_node, 0};
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator{nullptr, 0};
+    }
+
+    // Возвращает количество элементов в списке за время O(1)
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Сообщает, пустой ли список за время O(1)
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Вставляет элемент value в начало списка за время O(N)
+    void PushFront(const Type& value) {
+        EmplaceAfter(cbefore_begin(), value);
+    }
+
+    void PushFront(Type&& value) {
+        EmplaceAfter(cbefore_begin(), std::move(value));
+    }
+
+    // Вставляет элемент value в конец списка за время O(1)
+    void PushBack(const Type& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(Type&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    // Создаёт элемент из args в конце списка за время O(1)
+    // Если последний узел заполнен, заводит новый узел
+    template <typename... Args>
+    reference EmplaceBack(Args&&... args) {
+        if (last_node_ == nullptr || last_node_->count == N) {
+            // Узел принадлежит unique_ptr, пока элемент не создан:
+            // если конструктор Type выбросит исключение, узел
+            // освободится
+            std::unique_ptr<Node> holder(CreateNode());
+            Type* value = ::new (holder->Values())
+                Type(std::forward<Args>(args)...);
+            Node* node = holder.release();
+            node->next_node = nullptr;
+            node->count = 1;
+            (last_node_ != nullptr ? last_node_ : &head_)->next_node = node;
+            last_node_ = node;
+            ++size_;
+            return *value;
+        }
+        Type* value = ::new (last_node_->Values() + last_node_->count)
+            Type(std::forward<Args>(args)...);
+        ++last_node_->count;
+        ++size_;
+        return *value;
+    }
+
+    /*
+     * Вставляет элемент value после элемента, на который указывает
+     * pos.
+     * Возвращает итератор на вставленный элемент
+     */
+    Iterator InsertAfter(ConstIterator pos, const Type& value) {
+        return EmplaceAfter(pos, value);
+    }
+
+    Iterator InsertAfter(ConstIterator pos, Type&& value) {
+        return EmplaceAfter(pos, std::move(value));
+    }
+
+    /*
+     * Создаёт элемент из args после элемента, на который указывает
+     * pos. Элементы узла за позицией вставки сдвигаются. Если узел
+     * заполнен, он делится пополам, а вставка в его конец или в
+     * начало списка заводит новый узел
+     * Возвращает итератор на вставленный элемент
+     */
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
+        assert(pos.node_ != nullptr);
+        Type value(std::forward<Args>(args)...);
+
+        NodeBase* prev = pos.node_;
+        Node* node = nullptr;
+        size_t index = 0;
+        if (prev == &head_) {
+            node = static_cast<Node*>(head_.next_node);
+        } else {
+            node = static_cast<Node*>(prev);
+            index = pos.index_ + 1;
+        }
+
+        if (node == nullptr || node->count == N) {
+            if (node == nullptr || index == 0 || index == N) {
+                // Новый узел после prev либо после заполненного node
+                NodeBase* link = (node != nullptr && index == N) ? node
+                                                                 : prev;
+                std::unique_ptr<Node> holder(CreateNode());
+                ::new (holder->Values()) Type(std::move(value));
+                Node* new_node = holder.release();
+                new_node->count = 1;
+                new_node->next_node = link->next_node;
+                link->next_node = new_node;
+                if (new_node->next_node == nullptr) {
+                    last_node_ = new_node;
+                }
+                ++size_;
+                return Iterator{new_node, 0};
+            }
+            Node* upper = SplitNode(node);
+            if (index > node->count) {
+                index -= node->count;
+                node = upper;
+            }
+        }
+        InsertIntoNode(node, index, std::move(value));
+        ++size_;
+        return Iterator{node, index};
+    }
+
+    // Удаляет первый элемент списка
+    void PopFront() noexcept {
+        assert(!IsEmpty());
+        EraseAfter(cbefore_begin());
+    }
+
+    /*
+     * Удаляет элемент, следующий за pos.
+     * Возвращает итератор на элемент, следующий за удалённым
+     * Опустевший узел удаляется из цепочки
+     */
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        assert(pos.node_ != nullptr);
+        ConstIterator target = pos;
+        ++target;
+        assert(target.node_ != nullptr);
+
+        Node* node = static_cast<Node*>(target.node_);
+        const size_t index = target.index_;
+        Type* values = node->Values();
+        for (size_t i = index; i + 1 < node->count; ++i) {
+            values[i] = std::move(values[i + 1]);
+        }
+        values[node->count - 1].~Type();
+        --node->count;
+        --size_;
+
+        if (node->count == 0) {
+            // Узел содержал только удаляемый элемент, значит pos
+            // указывает на последний элемент предыдущего узла
+            NodeBase* prev = pos.node_;
+            prev->next_node = node->next_node;
+            if (last_node_ == node) {
+                last_node_ = prev == &head_ ? nullptr
+                                            : static_cast<Node*>(prev);
+            }
+            delete node;
+            return Iterator{prev->next_node, 0};
+        }
+        if (index < node->count) {
+            return Iterator{node, index};
+        }
+        return Iterator{node->next_node, 0};
+    }
+
+    // Очищает список за время O(N)
+    void Clear() noexcept {
+        NodeBase* node = head_.next_node;
+        while (node != nullptr) {
+            Node* current = static_cast<Node*>(node);
+            node = node->next_node;
+            std::destroy_n(current->Values(), current->count);
+            delete current;
+        }
+        head_.next_node = nullptr;
+        size_ = 0;
+        last_node_ = nullptr;
+    }
+
+    /*
+     * Возвращает итератор на первый элемент, равный value, либо end().
+     * Элементы каждого узла лежат подряд и просматриваются ядром
+     * SimdKernels, которое для арифметических типов сравнивает
+     * сразу несколько элементов
+     */
+    [[nodiscard]] Iterator Find(const Type& value) {
+        const ConstIterator it = std::as_const(*this).Find(value);
+        return Iterator{it.node_, it.index_};
+    }
+
+    [[nodiscard]] ConstIterator Find(const Type& value) const {
+        for (NodeBase* node = head_.next_node; node != nullptr;
+             node = node->next_node) {
+            const size_t index =
+                SimdKernels::Find(ValuesOf(node), node->count, value);
+            if (index != node->count) {
+                return ConstIterator{node, index};
+            }
+        }
+        return cend();
+    }
+
+    // Возвращает количество элементов, равных value
+    [[nodiscard]] size_t Count(const Type& value) const {
+        size_t count = 0;
+        for (NodeBase* node = head_.next_node; node != nullptr;
+             node = node->next_node) {
+            count += SimdKernels::Count(ValuesOf(node), node->count, value);
+        }
+        return count;
+    }
+
+    // Сообщает, есть ли в списке элемент, равный value
+    [[nodiscard]] bool Contains(const Type& value) const {
+        return Find(value) != cend();
+    }
+
+    // Возвращает сумму элементов, начиная с init. Для чисел с
+    // плавающей точкой порядок сложения не определён
+    [[nodiscard]] Type Sum(Type init = Type()) const {
+        for (NodeBase* node = head_.next_node; node != nullptr;
+             node = node->next_node) {
+            init = SimdKernels::Sum(ValuesOf(node), node->count,
+                                    std::move(init));
+        }
+        return init;
+    }
+
+    // Возвращает наименьший и наибольший элементы непустого списка
+    [[nodiscard]] std::pair<Type, Type> MinMax() const {
+        assert(!IsEmpty());
+        NodeBase* node = head_.next_node;
+        auto result = SimdKernels::MinMax(ValuesOf(node), node->count);
+        for (node = node->next_node; node != nullptr;
+             node = node->next_node) {
+            const auto [min, max] =
+                SimdKernels::MinMax(ValuesOf(node), node->count);
+            if (min < result.first) {
+                result.first = min;
+            }
+            if (result.second < max) {
+                result.second = max;
+            }
+        }
+        return result;
+    }
+
+    // Возвращает количество узлов в цепочке за время O(size / N)
+    [[nodiscard]] size_t GetNodeCount() const noexcept {
+        size_t count = 0;
+        for (const NodeBase* node = head_.next_node; node != nullptr;
+             node = node->next_node) {
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    template <typename T, size_t M>
+    friend bool operator==(const UnrolledSingleLinkedList<T, M>& lhs,
+                           const UnrolledSingleLinkedList<T, M>& rhs);
+
+    static const Type* ValuesOf(NodeBase* node) noexcept {
+        return static_cast<Node*>(node)->Values();
+    }
+
+    static Node* CreateNode() {
+        return new Node;
+    }
+
+    // Вставляет value в позицию index узла node, у которого есть
+    // свободная ячейка
+    static void InsertIntoNode(Node* node, size_t index,
+                               Type&& value) {
+        assert(node->count < N && index <= node->count);
+        Type* values = node->Values();
+        if (index == node->count) {
+            ::new (values + index) Type(std::move(value));
+        } else {
+            ::new (values + node->count)
+                Type(std::move(values[node->count - 1]));
+            for (size_t i = node->count - 1; i > index; --i) {
+                values[i] = std::move(values[i - 1]);
+            }
+            values[index] = std::move(value);
+        }
+        ++node->count;
+    }
+
+    // Переносит верхнюю половину элементов заполненного узла node в
+    // новый узел, вставленный сразу после него
+    Node* SplitNode(Node* node) {
+        Node* upper = CreateNode();
+        const size_t keep = N / 2;
+        Type* from = node->Values() + keep;
+        std::uninitialized_move_n(from, N - keep, upper->Values());
+        std::destroy_n(from, N - keep);
+        upper->count = N - keep;
+        node->count = keep;
+        upper->next_node = node->next_node;
+        node->next_node = upper;
+        if (last_node_ == node) {
+            last_node_ = upper;
+        }
+        return upper;
+    }
+
+    // Фиктивный узел, используется для вставки
+    // "перед первым элементом"
+    NodeBase head_;
+    size_t size_ = 0;
+    Node* last_node_ = nullptr;
+};
+
+template <typename Type, size_t N>
+void swap(UnrolledSingleLinkedList<Type, N>& lhs,
+          UnrolledSingleLinkedList<Type, N>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type, size_t N>
+bool operator==(const UnrolledSingleLinkedList<Type, N>& lhs,
+                const UnrolledSingleLinkedList<Type, N>& rhs) {
+    if (lhs.GetSize() != rhs.GetSize()) {
+        return false;
+    }
+    // Сравниваем общие части текущих узлов обоих списков: элементы
+    // внутри узла лежат подряд, поэтому сравнение идёт блоками
+    using List = UnrolledSingleLinkedList<Type, N>;
+    auto* lhs_node = lhs.head_.next_node;
+    auto* rhs_node = rhs.head_.next_node;
+    size_t lhs_index = 0;
+    size_t rhs_index = 0;
+    while (lhs_node != nullptr) {
+        const size_t count = std::min(lhs_node->count - lhs_index,
+                                      rhs_node->count - rhs_index);
+        if (!SimdKernels::Equal(List::ValuesOf(lhs_node) + lhs_index,
+                                List::ValuesOf(rhs_node) + rhs_index,
+                                count)) {
+            return false;
+        }
+        lhs_index += count;
+        rhs_index += count;
+        if (lhs_index == lhs_node->count) {
+            lhs_node = lhs_node->next_node;
+            lhs_index = 0;
+        }
+        if (rhs_index == rhs_node->count) {
+            rhs_node = rhs_node->next_node;
+            rhs_index = 0;
+        }
+    }
+    return true;
+}
+
+template <typename Type, size_t N>
+bool operator!=(const UnrolledSingleLinkedList<Type, N>& lhs,
+                const UnrolledSingleLinkedList<Type, N>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t N>
+bool operator<(const UnrolledSingleLinkedList<Type, N>& lhs,
+               const UnrolledSingleLinkedList<Type, N>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(),
+                                        rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t N>
+bool operator<=(const UnrolledSingleLinkedList<Type, N>& lhs,
+                const UnrolledSingleLinkedList<Type, N>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type, size_t N>
+bool operator>(const UnrolledSingleLinkedList<Type, N>& lhs,
+               const UnrolledSingleLinkedList<Type, N>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type, size_t N>
+bool operator>=(const UnrolledSingleLinkedList<Type, N>& lhs,
+                const UnrolledSingleLinkedList<Type, N>& rhs) {
+    return !(lhs < rhs);
+}
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Пул потоков с перехватом задач (work stealing).
+ * У каждого потока своя очередь задач. Поток берёт задачи с конца
+ * своей очереди, а когда она пуста — забирает задачи с начала
+ * очередей других потоков. Так потоки, быстро закончившие свою часть,
+ * разгружают отстающие.
+ * ParallelFor распределяет индексы задач непрерывными диапазонами по
+ * очередям и участвует в работе сам, поэтому пул из thread_count
+ * потоков создаёт thread_count - 1 рабочих потоков
+ */
+class WorkStealingPool {
+public:
+    // Создаёт пул из thread_count потоков, включая вызывающий
+    explicit WorkStealingPool(size_t thread_count = DefaultThreadCount())
+        : queue_count_(std::max<size_t>(thread_count, 1))
+        , queues_(std::make_unique<Queue[]>(queue_count_)) {
+        workers_.reserve(queue_count_ - 1);
+        for (size_t id = 0; id + 1 < queue_count_; ++id) {
+            workers_.emplace_back([this, id] {
+                WorkerLoop(id);
+            });
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    ~WorkStealingPool() {
+        {
+            std::lock_guard guard(sleep_mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    // Возвращает общий пул процесса с DefaultThreadCount потоками
+    static WorkStealingPool& Default() {
+        static WorkStealingPool pool;
+        return pool;
+    }
+
+    static size_t DefaultThreadCount() noexcept {
+        return std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+    }
+
+    // Количество потоков, выполняющих задачи, включая вызывающий
+    [[nodiscard]] size_t GetThreadCount() const noexcept {
+        return queue_count_;
+    }
+
+    /*
+     * Выполняет body(i) для каждого i из [0, count) и ждёт
+     * завершения всех вызовов. Порядок и потоки вызовов не
+     * определены. Если вызовы выбросят исключения, после завершения
+     * остальных вызовов будет выброшено первое из них
+     */
+    template <typename Body>
+    void ParallelFor(size_t count, Body&& body) {
+        if (count == 0) {
+            return;
+        }
+        Job job;
+        job.body = &body;
+        job.run = [](const void* body_ptr, size_t index) {
+            (*static_cast<std::remove_reference_t<Body>*>(
+                const_cast<void*>(body_ptr)))(index);
+        };
+        job.remaining.store(count);
+        // Счётчик увеличивается до публикации задач: иначе поток,
+        // перехвативший задачу раньше, уменьшил бы его ниже нуля
+        {
+            std::lock_guard guard(sleep_mutex_);
+            pending_ += count;
+        }
+        for (size_t q = 0; q < queue_count_; ++q) {
+            const size_t first = count * q / queue_count_;
+            const size_t last = count * (q + 1) / queue_count_;
+            if (first == last) {
+                continue;
+            }
+            std::lock_guard guard(queues_[q].mutex);
+            // Владелец берёт задачи с конца, поэтому кладём их в
+            // обратном порядке: сам поток пойдёт по диапазону вперёд
+            for (size_t i = last; i-- > first;) {
+                queues_[q].tasks.push_back(Task{&job, i});
+            }
+        }
+        wake_.notify_all();
+
+        // Вызывающий поток работает как владелец последней очереди
+        const size_t self = queue_count_ - 1;
+        while (job.remaining.load() != 0 && TryRunTask(self)) {
+        }
+        // Ожидание под мьютексом гарантирует, что поток, завершивший
+        // последнюю задачу, больше не обращается к job
+        std::unique_lock lock(job.mutex);
+        job.done.wait(lock, [&job] {
+            return job.finished;
+        });
+        if (job.error) {
+            std::rethrow_exception(job.error);
+        }
+    }
+
+private:
+    // Один вызов ParallelFor
+    struct Job {
+        void (*run)(const void* body, size_t index) = nullptr;
+        const void* body = nullptr;
+        std::atomic<size_t> remaining{0};
+        std::mutex mutex;
+        std::condition_variable done;
+        std::exception_ptr error;
+        bool finished = false;
+    };
+
+    struct Task {
+        Job* job;
+        size_t index;
+    };
+
+    // Выравнивание исключает ложное разделение кэш-линий между
+    // очередями разных потоков
+    struct alignas(64) Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    // Берёт задачу из своей очереди либо перехватывает чужую
+    bool TryPopTask(size_t self, Task& task) {
+        {
+            std::lock_guard guard(queues_[self].mutex);
+            if (!queues_[self].tasks.empty()) {
+                task = queues_[self].tasks.back();
+                queues_[self].tasks.pop_back();
+                return true;
+            }
+        }
+        for (size_t offset = 1; offset < queue_count_; ++offset) {
+            Queue& victim = queues_[(self + offset) % queue_count_];
+            std::lock_guard guard(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = victim.tasks.front();
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Выполняет одну задачу, если она нашлась
+    bool TryRunTask(size_t self) {
+        Task task;
+        if (!TryPopTask(self, task)) {
+            return false;
+        }
+        {
+            std::lock_guard guard(sleep_mutex_);
+            --pending_;
+        }
+        Job& job = *task.job;
+        try {
+            job.run(job.body, task.index);
+        } catch (...) {
+            std::lock_guard guard(job.mutex);
+            if (!job.error) {
+                job.error = std::current_exception();
+            }
+        }
+        if (job.remaining.fetch_sub(1) == 1) {
+            std::lock_guard guard(job.mutex);
+            job.finished = true;
+            job.done.notify_all();
+        }
+        return true;
+    }
+
+    void WorkerLoop(size_t self) {
+        while (true) {
+            if (TryRunTask(self)) {
+                continue;
+            }
+            std::unique_lock lock(sleep_mutex_);
+            wake_.wait(lock, [this] {
+                return stop_ || pending_ != 0;
+            });
+            if (stop_) {
+                return;
+            }
+        }
+    }
+
+    size_t queue_count_;
+    std::unique_ptr<Queue[]> queues_;
+    std::vector<std::thread> workers_;
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    // Количество задач в очередях, ещё не взятых на выполнение
+    size_t pending_ = 0;
+    bool stop_ = false;
+};